@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** benchmark parsing a full mct dump through CommandParser, from a recorded
+** server capture or a generated 1000x1000 map (1M bct lines)
+*/
+
+#include "zappy/network/protocol/CommandParser.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace {
+    constexpr int GENERATED_SIZE = 1000;
+    constexpr int RUNS = 3;
+    constexpr size_t RECEIVE_CHUNK_SIZE = 16384;
+
+    // Même contenu qu'une réponse à "msz" puis "mct"
+    std::string generateDump() {
+        std::string dump = "msz " + std::to_string(GENERATED_SIZE) + " "
+            + std::to_string(GENERATED_SIZE) + "\n";
+        unsigned int seed = 42;
+
+        dump.reserve(static_cast<size_t>(GENERATED_SIZE) * GENERATED_SIZE * 24);
+        for (int y = 0; y < GENERATED_SIZE; ++y) {
+            for (int x = 0; x < GENERATED_SIZE; ++x) {
+                dump += "bct " + std::to_string(x) + " " + std::to_string(y);
+                for (int i = 0; i < 7; ++i) {
+                    seed = seed * 1103515245u + 12345u;
+                    dump += " " + std::to_string((seed >> 16) % (i == 0 ? 12 : 3));
+                }
+                dump += "\n";
+            }
+        }
+        return dump;
+    }
+
+    bool loadDump(const char* path, std::string& dump) {
+        std::ifstream file(path, std::ios::binary);
+        std::ostringstream content;
+
+        if (!file) {
+            std::cerr << "Cannot open " << path << std::endl;
+            return false;
+        }
+        content << file.rdbuf();
+        dump = content.str();
+        return true;
+    }
+
+    // Appelle f sur chaque ligne comme NetworkManager::processReceivedData
+    template <typename F>
+    double timeLines(std::string_view dump, size_t& lines, F&& f) {
+        auto start = std::chrono::steady_clock::now();
+        size_t offset = 0;
+        size_t newline;
+
+        lines = 0;
+        while ((newline = dump.find('\n', offset)) != std::string_view::npos) {
+            f(dump.substr(offset, newline - offset));
+            offset = newline + 1;
+            ++lines;
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void report(const char* name, double ms, size_t lines, size_t bytes) {
+        std::cout << name << ": " << ms << " ms, "
+                  << ms * 1e6 / static_cast<double>(lines) << " ns/line, "
+                  << static_cast<double>(bytes) / (ms * 1e3) << " MB/s" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string dump;
+
+    if (argc > 2 || (argc == 2 && !loadDump(argv[1], dump))) {
+        std::cerr << "Usage: " << argv[0] << " [mct_dump_file]" << std::endl;
+        return 84;
+    }
+    if (argc == 1) {
+        dump = generateDump();
+    }
+
+    double tokenize_ms = 0;
+    double parse_ms = 0;
+    size_t lines = 0;
+    for (int run = 0; run < RUNS; ++run) {
+        zappy::network::protocol::TokenList tokens;
+        double ms = timeLines(dump, lines, [&tokens](std::string_view line) {
+            zappy::network::protocol::CommandParser::tokenize(line, tokens);
+        });
+        tokenize_ms = run == 0 ? ms : std::min(tokenize_ms, ms);
+
+        // Etat neuf à chaque passe pour mesurer aussi les mises à jour de cases
+        auto state = std::make_shared<zappy::game::world::SharedGameState>();
+        zappy::network::protocol::CommandParser parser(state);
+        // Les bct sont appliquées par lot, comme après chaque recv() de 16 Ko
+        size_t batch_bytes = 0;
+        ms = timeLines(dump, lines, [&parser, &batch_bytes](std::string_view line) {
+            parser.parseMessage(line);
+            batch_bytes += line.size() + 1;
+            if (batch_bytes >= RECEIVE_CHUNK_SIZE) {
+                parser.flushTileUpdates();
+                batch_bytes = 0;
+            }
+        });
+        auto flush_start = std::chrono::steady_clock::now();
+        parser.flushTileUpdates();
+        ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - flush_start).count();
+        parse_ms = run == 0 ? ms : std::min(parse_ms, ms);
+    }
+
+    std::cout << lines << " lines, " << dump.size() << " bytes, best of " << RUNS << std::endl;
+    report("tokenize only", tokenize_ms, lines, dump.size());
+    report("parseMessage", parse_ms, lines, dump.size());
+    return 0;
+}
@@ -91,15 +91,18 @@ private:
     void printWelcomeMessage();
     void updateSelectionsAfterStateChange();
     
-    // Thread-safe accessors to SharedGameState
-    std::vector<std::vector<zappy::game::world::ZappyTile>> getWorldMapSafe() const;
-    std::map<int, zappy::game::entities::ZappyPlayer> getPlayersSafe() const;
+    // Snapshot of the SharedGameState used for the whole frame
+    void refreshSnapshot();
+    
+    // Frame time of the 3D passes and chunk counts for the stats panel
+    void fillSceneStats(zappy::graphics::renderers::UIRenderer::GameStats& stats);
     
     // Configuration and state
     AppConfig _config;
     bool _running = false;
     bool _initialized = false;
     float _current_fps = 60.0f;
+    float _scene_time_by_lod[2] = {0.0f, 0.0f};  // Moyenne glissante, sans LOD puis avec
     
     // Graphics components
     sf::RenderWindow _window;
@@ -111,6 +114,9 @@ private:
     
     // Shared game state (managed by network thread)
     std::shared_ptr<zappy::game::world::SharedGameState> _shared_state;
+    std::shared_ptr<const zappy::game::world::GameSnapshot> _snapshot;
+    std::uint64_t _selection_generation = 0;    // Snapshot the selections were built from
+    std::vector<zappy::game::world::GameEvent> _game_events;   // Reused by processGameEvents
     
     // Selection states
     zappy::graphics::renderers::UIRenderer::TileInfo _current_tile_selection;
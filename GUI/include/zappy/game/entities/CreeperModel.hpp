@@ -9,6 +9,8 @@
 #define CREEPERMODEL_HPP
 
 #include <SFML/Graphics.hpp>
+#include <map>
+#include <vector>
 #include "zappy/graphics/utils/ModelLoader.hpp"
 #include "zappy/graphics/utils/MathUtils.hpp"
 #include "zappy/game/entities/Player.hpp"
@@ -56,6 +58,10 @@ public:
     // Main rendering method
     void renderPlayer(const zappy::game::entities::ZappyPlayer& player, float delta_time = 0.016f);
     
+    // Tous les joueurs en un seul appel instancié
+    void renderPlayers(const std::vector<const zappy::game::entities::ZappyPlayer*>& players);
+    bool isInstancingReady() const { return _program != 0; }
+    
     // Contrôles de configuration
     void setEnabled(bool enabled) { _config.enabled = enabled; }
     void toggleEnabled() { _config.enabled = !_config.enabled; }
@@ -76,6 +82,16 @@ public:
     void printStatus() const;
 
 private:
+    struct PlayerInstance {
+        float x, y, z, scale;
+        float cos_yaw, sin_yaw;
+        sf::Color color;
+    };
+    
+    // False without OpenGL 3.3 or without a model buffer, renderPlayer stays in use
+    bool initializeInstancing();
+    void releaseInstancing();
+    
     void renderCreeperModel(const MathUtils::Vector3f& position, 
                            const MathUtils::Vector3f& rotation,
                            const MathUtils::Vector3f& scale,
@@ -104,6 +120,14 @@ private:
     
     // Cache des variations de couleur par équipe
     mutable std::map<std::string, TeamColorVariation> _team_variations_cache;
+    
+    // Rendu instancié, le modèle reste dans le buffer du Model
+    GLuint _program = 0;
+    GLint _textured_location = -1;
+    GLuint _vertex_array = 0;
+    GLuint _instance_buffer = 0;
+    size_t _instance_capacity = 0;
+    std::vector<PlayerInstance> _instances;
 };
 }
 
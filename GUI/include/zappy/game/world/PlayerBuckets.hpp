@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** PlayerBuckets
+*/
+
+#ifndef PLAYERBUCKETS_HPP_
+#define PLAYERBUCKETS_HPP_
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "zappy/game/entities/Player.hpp"
+
+namespace zappy::game::world {
+
+// Index des joueurs par tile : ids triés par tile (y * width + x) puis par id.
+// Reconstruit avec les joueurs du snapshot, en O(joueurs log joueurs).
+class PlayerBuckets {
+public:
+    void rebuild(const std::map<int, zappy::game::entities::ZappyPlayer>& players, int width, int height);
+
+    // Calls f(player_id) for every player standing on (x, y), by increasing id
+    template <typename F>
+    void forEachOnTile(int x, int y, F&& f) const {
+        if (x < 0 || y < 0 || x >= _width || y >= _height) {
+            return;
+        }
+        int tile = y * _width + x;
+        auto it = std::lower_bound(_entries.begin(), _entries.end(), tile,
+            [](const Entry& entry, int value) { return entry.tile < value; });
+        for (; it != _entries.end() && it->tile == tile; ++it) {
+            f(it->player_id);
+        }
+    }
+
+private:
+    struct Entry {
+        int tile;
+        int player_id;
+    };
+
+    std::vector<Entry> _entries;
+    int _width = 0;
+    int _height = 0;
+};
+
+}
+
+#endif /* !PLAYERBUCKETS_HPP_ */
@@ -13,15 +13,20 @@
 #include <string>
 #include <mutex>
 #include <atomic>
-#include <queue>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 #include "zappy/game/world/Tile.hpp"
+#include "zappy/game/world/TileChanges.hpp"
+#include "zappy/game/world/PlayerBuckets.hpp"
+#include "zappy/game/world/SpscRing.hpp"
+#include "zappy/game/world/StringTable.hpp"
+#include "zappy/game/world/TextSlots.hpp"
 #include "zappy/game/entities/Player.hpp"
 
 namespace zappy::game::world {
 
-// Événements du jeu
+// Événements du jeu, copiés tels quels dans la file sans verrou
 struct GameEvent {
     enum Type {
         PLAYER_MOVED,
@@ -31,22 +36,30 @@ struct GameEvent {
         INCANTATION_STARTED,
         INCANTATION_ENDED,
         EGG_LAID,
-        BROADCAST_RECEIVED
+        BROADCAST_RECEIVED,
+        REGION_CHANGED              // One per tile batch, details in GameSnapshot::tile_changes
     };
     
-    Type type;
+    Type type = RESOURCE_CHANGED;
     int player_id = -1;
     int x = -1;
     int y = -1;
-    std::string message;
-    std::map<std::string, int> data;
+    int level = -1;             // PLAYER_LEVELED, INCANTATION_STARTED
+    int player_count = 0;       // INCANTATION_STARTED
+    int result = -1;            // INCANTATION_ENDED
+    int egg_id = -1;            // Egg events
+    int resource_type = -1;     // RESOURCE_CHANGED from pdr / pgt
+    int action = -1;            // 0 = drop, 1 = take
+    int width = 0;              // REGION_CHANGED bounding box from x, y
+    int height = 0;
+    StringTable::Id message = StringTable::EMPTY;  // Fixed tag, SharedGameState::getEventString
+    TextId text = NO_TEXT;      // Free-form text, SharedGameState::getEventText then releaseEventText
 };
 
 // Commandes réseau à envoyer
 struct NetworkCommand {
-    std::string command;
+    TextId command = NO_TEXT;   // SharedGameState::getCommandString then releaseCommandString
     int priority = 0;
-    std::string response_expected;
 };
 
 struct ZappyBroadcast {
@@ -64,14 +77,26 @@ struct ZappyBroadcast {
           timestamp(std::chrono::steady_clock::now()) {}
 };
 
+// Etat immuable publié par le thread réseau pour le rendu
+struct GameSnapshot {
+    std::uint64_t generation = 0;    // Incrémenté à chaque publication
+    int map_width = 0;
+    int map_height = 0;
+    std::vector<std::vector<ZappyTile>> world_map;
+    std::map<int, zappy::game::entities::ZappyPlayer> players;
+    PlayerBuckets player_buckets;    // Players of each tile, rebuilt with players
+    TileChanges tile_changes;        // Since a generation the renderer already had
+};
+
 class SharedGameState {
 public:
-    SharedGameState() = default;
+    SharedGameState();
     ~SharedGameState() = default;
     
     // Map management
     void setMapSize(int width, int height);
-    void updateTile(int x, int y, const std::vector<int>& resources);
+    // Resources of each tile.x, tile.y under one lock, with one REGION_CHANGED event
+    void updateTiles(const std::vector<ZappyTile>& tiles);
     void updateAllTiles(const std::vector<std::vector<ZappyTile>>& tiles);
     
     // Player management  
@@ -96,13 +121,28 @@ public:
     // Team management
     void setTeamNames(const std::vector<std::string>& teams);
     
-    // Event system
-    void addEvent(const GameEvent& event);
-    std::vector<GameEvent> getAndClearEvents();
-    
-    // Network commands
-    void addPendingCommand(const NetworkCommand& command);
-    std::vector<NetworkCommand> getAndClearPendingCommands();
+    // Event system: network thread -> render thread, without locking
+    bool addEvent(const GameEvent& event);                          // Network thread, cancels its text if full
+    StringTable::Id internEventString(std::string_view tag);        // Network thread, fixed tags only
+    TextId copyEventText(std::string_view text);                    // Network thread
+    std::size_t drainEvents(std::vector<GameEvent>& events);        // Render thread
+    const std::string& getEventString(StringTable::Id id) const { return _event_strings.get(id); }
+    const std::string& getEventText(TextId id) const { return _event_texts.get(id); }
+    void releaseEventText(TextId id) { _event_texts.release(id); }  // Render thread
+    
+    // Network commands: render thread -> network thread, without locking
+    bool addPendingCommand(std::string_view command, int priority = 0);     // Render thread
+    std::size_t drainPendingCommands(std::vector<NetworkCommand>& commands); // Network thread
+    const std::string& getCommandString(TextId id) const { return _command_texts.get(id); }
+    void releaseCommandString(TextId id) { _command_texts.release(id); }   // Network thread
+    
+    // Snapshots: the network thread publishes, the renderer reads in O(1)
+    void publishSnapshot();
+    std::shared_ptr<const GameSnapshot> getSnapshot() const;
+    std::uint64_t getGeneration() const { return _generation.load(); }
+    // Render thread: the renderers hold the map of this generation, the next
+    // tile_changes can start from it
+    void acknowledgeGeneration(std::uint64_t generation) { _rendered_generation.store(generation); }
     
     // Getters (thread-safe)
     std::vector<std::vector<ZappyTile>> getWorldMap() const;
@@ -132,6 +172,15 @@ public:
     void dumpState() const;
     
 private:
+    void markTileDirty(int x, int y);
+    void markAllTilesDirty();
+    bool storeTile(const ZappyTile& resources);
+    struct SnapshotSlot;
+    int findFreeSlot() const;
+    void refreshSlot(SnapshotSlot& slot);
+    void recordMissed(SnapshotSlot& slot);
+    void accumulateTileChanges();
+
     mutable std::mutex _mutex;
     
     // Map data
@@ -156,9 +205,38 @@ private:
     // Connection state
     std::atomic<bool> _connected{false};
     
-    // Events and commands
-    std::queue<GameEvent> _events;
-    std::queue<NetworkCommand> _pending_commands;
+    // Events and commands, each ring has one producer and one consumer
+    // thread and never touches _mutex
+    static constexpr size_t EVENT_CAPACITY = 4096;
+    static constexpr size_t COMMAND_CAPACITY = 256;
+    SpscRing<GameEvent, EVENT_CAPACITY> _events;
+    SpscRing<NetworkCommand, COMMAND_CAPACITY> _pending_commands;
+    StringTable _event_strings;     // Tags interned by the network thread
+    TextSlots<EVENT_CAPACITY> _event_texts;     // Written by the network thread
+    TextSlots<COMMAND_CAPACITY> _command_texts; // Written by the render thread
+
+    // Snapshot pool: the front, the one the renderer may still hold and a
+    // free one. Each slot only copies what was published since it was written.
+    struct SnapshotSlot {
+        std::shared_ptr<GameSnapshot> snapshot;
+        std::vector<int> missed_tiles;          // y * width + x
+        std::vector<std::uint8_t> missed_marks; // Avoids duplicates in missed_tiles
+        bool missed_all_tiles = true;
+        bool missed_players = true;
+    };
+    static constexpr int SNAPSHOT_SLOTS = 3;
+    SnapshotSlot _slots[SNAPSHOT_SLOTS];
+    int _front_slot = 0;
+
+    // _front is only accessed through std::atomic_load/exchange
+    std::shared_ptr<GameSnapshot> _front;
+    std::atomic<std::uint64_t> _generation{0};
+    std::vector<int> _dirty_tiles;          // y * width + x, since the last publish
+    std::vector<std::uint8_t> _dirty_marks; // Avoids duplicates in _dirty_tiles
+    bool _all_tiles_dirty = true;
+    bool _players_dirty = true;
+    TileChanges _tile_changes;              // Accumulated until the renderer catches up
+    std::atomic<std::uint64_t> _rendered_generation{0};
 };
 
 }
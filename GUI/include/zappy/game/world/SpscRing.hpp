@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** SpscRing
+*/
+
+#ifndef SPSCRING_HPP_
+#define SPSCRING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace zappy::game::world {
+
+// File circulaire sans verrou : un seul thread appelle tryPush, un seul
+// thread appelle tryPop. Les deux opérations terminent en temps borné.
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpscRing only stores trivially copyable payloads");
+
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Producer thread only, false when the ring is full
+    bool tryPush(const T& value) {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+
+        if (head - _cached_tail == Capacity) {
+            _cached_tail = _tail.load(std::memory_order_acquire);
+            if (head - _cached_tail == Capacity) {
+                return false;
+            }
+        }
+        _slots[head & (Capacity - 1)] = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only, false when the ring is empty
+    bool tryPop(T& value) {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+
+        if (tail == _cached_head) {
+            _cached_head = _head.load(std::memory_order_acquire);
+            if (tail == _cached_head) {
+                return false;
+            }
+        }
+        value = _slots[tail & (Capacity - 1)];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximatif quand l'autre thread est actif
+    std::size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+private:
+    // Index producteur et consommateur sur des lignes de cache distinctes
+    alignas(64) std::atomic<std::size_t> _head{0};
+    std::size_t _cached_tail = 0;           // Producer's view of _tail
+    alignas(64) std::atomic<std::size_t> _tail{0};
+    std::size_t _cached_head = 0;           // Consumer's view of _head
+    alignas(64) T _slots[Capacity];
+};
+
+}
+
+#endif /* !SPSCRING_HPP_ */
@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** StringTable
+*/
+
+#ifndef STRINGTABLE_HPP_
+#define STRINGTABLE_HPP_
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace zappy::game::world {
+
+// Étiquettes fixes ("expelled", "success"...) qui traversent une SpscRing.
+// Seul le thread producteur appelle intern(). Les chaînes ne sont jamais
+// déplacées, le consommateur lit donc sans verrou tout id reçu par la file.
+// Le texte libre passe par TextSlots, la table ne grandit qu'avec le code.
+class StringTable {
+public:
+    using Id = std::uint32_t;
+    static constexpr Id EMPTY = 0;
+
+    StringTable();
+    StringTable(const StringTable&) = delete;
+    StringTable& operator=(const StringTable&) = delete;
+
+    // Producer thread only, EMPTY once the table is full
+    Id intern(std::string_view text);
+    // Any thread, for ids received through the ring
+    const std::string& get(Id id) const;
+    std::size_t size() const { return _count; }     // Producer thread only
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 256;
+    static constexpr std::size_t MAX_BLOCKS = 256;
+
+    std::unique_ptr<std::string[]> _blocks[MAX_BLOCKS];
+    std::unordered_map<std::string_view, Id> _ids;  // Views of the stored strings
+    std::size_t _count = 0;
+};
+
+}
+
+#endif /* !STRINGTABLE_HPP_ */
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** TextSlots
+*/
+
+#ifndef TEXTSLOTS_HPP_
+#define TEXTSLOTS_HPP_
+
+#include "zappy/game/world/SpscRing.hpp"
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace zappy::game::world {
+
+using TextId = std::uint32_t;      // Same for every TextSlots size
+constexpr TextId NO_TEXT = 0;
+
+// Textes libres (broadcasts, commandes) qui accompagnent une SpscRing.
+// Le producteur écrit dans un slot libre et envoie son id dans la file,
+// le consommateur lit le texte puis rend le slot. Les slots sont recyclés,
+// leur nombre reste borné quelle que soit la durée de la partie.
+template <std::size_t Count>
+class TextSlots {
+public:
+    using Id = TextId;
+    static constexpr Id NONE = NO_TEXT;
+
+    TextSlots() {
+        // Slot 0 is NONE, every other one starts free
+        for (Id id = 1; id < Count; id++) {
+            _released.tryPush(id);
+        }
+    }
+    TextSlots(const TextSlots&) = delete;
+    TextSlots& operator=(const TextSlots&) = delete;
+
+    // Producer thread only, NONE when every slot is still held
+    Id acquire(std::string_view text) {
+        Id id = NONE;
+
+        if (text.empty()) {
+            return NONE;
+        }
+        if (_spare != NONE) {
+            id = _spare;
+            _spare = NONE;
+        } else if (!_released.tryPop(id)) {
+            return NONE;
+        }
+        // Reuses the capacity left by the previous text of the slot
+        _slots[id].assign(text.data(), text.size());
+        return id;
+    }
+
+    // Producer thread only, for an id whose push into the ring failed
+    void cancel(Id id) {
+        if (id != NONE && id < Count) {
+            _spare = id;
+        }
+    }
+
+    // Consumer thread only, between the pop of the id and its release
+    const std::string& get(Id id) const {
+        return id < Count ? _slots[id] : _slots[NONE];
+    }
+
+    // Consumer thread only, once the text is no longer read
+    void release(Id id) {
+        if (id != NONE && id < Count) {
+            _released.tryPush(id);
+        }
+    }
+
+private:
+    std::string _slots[Count];
+    SpscRing<Id, Count> _released;  // Consumer pushes, producer pops
+    Id _spare = NONE;               // Producer side, given back by cancel
+};
+
+}
+
+#endif /* !TEXTSLOTS_HPP_ */
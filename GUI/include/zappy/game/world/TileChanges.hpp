@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** TileChanges
+*/
+
+#ifndef TILECHANGES_HPP_
+#define TILECHANGES_HPP_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace zappy::game::world {
+
+// Tiles modifiées après since_generation, un bit par tile (y * width + x).
+// Publié avec chaque snapshot pour les mises à jour GPU incrémentales.
+struct TileChanges {
+    std::uint64_t since_generation = 0;
+    bool all_tiles = true;
+    std::vector<std::uint64_t> bits;
+
+    // True when a consumer holding the map of that generation can apply
+    // only the marked tiles, false when it must rescan the whole map
+    bool appliesTo(std::uint64_t generation) const {
+        return !all_tiles && generation != 0 && since_generation <= generation;
+    }
+
+    bool isMarked(size_t index) const {
+        return all_tiles || ((bits[index / 64] >> (index % 64)) & 1);
+    }
+
+    void mark(size_t index) {
+        bits[index / 64] |= std::uint64_t(1) << (index % 64);
+    }
+
+    // Calls f(index) for every marked tile, in raster order
+    template <typename F>
+    void forEachTile(F&& f) const {
+        for (size_t word = 0; word < bits.size(); ++word) {
+            for (std::uint64_t rest = bits[word]; rest != 0; rest &= rest - 1) {
+                f(word * 64 + static_cast<size_t>(__builtin_ctzll(rest)));
+            }
+        }
+    }
+};
+
+}
+
+#endif /* !TILECHANGES_HPP_ */
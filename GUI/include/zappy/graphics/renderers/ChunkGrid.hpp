@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Map split in square chunks, tested against the view frustum
+*/
+
+#ifndef CHUNKGRID_HPP
+#define CHUNKGRID_HPP
+
+#include <vector>
+#include "zappy/graphics/utils/Frustum.hpp"
+
+namespace zappy::graphics::renderers {
+class ChunkGrid {
+public:
+    static constexpr int CHUNK_SIZE = 8;     // Tiles par côté de chunk
+
+    // Tiles [first, end) in slot order
+    struct SlotRange {
+        int first;
+        int end;
+    };
+
+    // Chunk extents in world space beyond the tile centers
+    struct Bounds {
+        float margin = 0.5f;        // Moitié d'une tile plus ce qui déborde
+        float min_y = 0.0f;
+        float max_y = 1.0f;
+    };
+
+    enum class Detail {
+        FULL,           // Tiles, piles de ressources et modèles
+        POINTS,         // Les joueurs deviennent des points
+        AGGREGATED      // One box for the whole chunk, players as points
+    };
+
+    // On-screen size of a tile at the nearest point of a chunk, in pixels
+    struct LodThresholds {
+        bool enabled = false;
+        float points_below = 12.0f;
+        float aggregate_below = 6.0f;
+    };
+
+public:
+    ChunkGrid() = default;
+    ~ChunkGrid() = default;
+
+    // Same width and height always give the same slot order
+    void resize(int width, int height);
+    bool matches(int width, int height) const { return _width == width && _height == height; }
+
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+    int getChunkCount() const { return static_cast<int>(_chunk_first.size()) - 1; }
+
+    // Slots: chunk after chunk, tiles of a chunk in raster order
+    int chunkOf(int x, int y) const;
+    int tileSlot(int x, int y) const { return _tile_slots[static_cast<size_t>(y) * _width + x]; }
+    int slotTile(int slot) const { return _slot_tiles[slot]; }
+    int chunkFirstSlot(int chunk) const { return _chunk_first[chunk]; }
+    void chunkTiles(int chunk, int& x0, int& y0, int& x1, int& y1) const;
+
+    // Without a frustum every chunk is visible and drawn in full detail
+    void updateVisibility(const zappy::graphics::utils::Frustum* frustum, const Bounds& bounds,
+                          const LodThresholds& lod);
+    bool isCulling() const { return _culling; }
+    bool isChunkVisible(int chunk) const { return _visible[chunk] != 0; }
+    Detail getChunkDetail(int chunk) const { return _detail[chunk]; }
+    const std::vector<int>& getVisibleChunks() const { return _visible_chunks; }
+    const std::vector<SlotRange>& getVisibleRanges() const { return _visible_ranges; }
+    int getVisibleTileCount() const { return _visible_tiles; }
+
+    // Visible chunks split by detail: tile ranges to draw one by one, and the aggregated ones
+    const std::vector<SlotRange>& getDetailRanges() const { return _detail_ranges; }
+    const std::vector<int>& getAggregatedChunks() const { return _aggregated_chunks; }
+    int getDetailTileCount() const { return _detail_tiles; }
+
+private:
+    Detail chunkDetail(const zappy::graphics::utils::Frustum& frustum, const MathUtils::Vector3f& min,
+                       const MathUtils::Vector3f& max, const LodThresholds& lod) const;
+    static void appendRange(std::vector<SlotRange>& ranges, int first, int end);
+
+    int _width = 0;
+    int _height = 0;
+    int _chunks_x = 0;
+    bool _culling = false;
+
+    std::vector<int> _tile_slots;        // Slot de chaque tile, en ordre raster
+    std::vector<int> _slot_tiles;        // Raster index of each slot
+    std::vector<int> _chunk_first;       // First slot of each chunk, plus the end
+    std::vector<char> _visible;
+    std::vector<int> _visible_chunks;
+    std::vector<SlotRange> _visible_ranges;  // Chunks visibles consécutifs fusionnés
+    int _visible_tiles = 0;
+
+    std::vector<Detail> _detail;
+    std::vector<SlotRange> _detail_ranges;
+    std::vector<int> _aggregated_chunks;
+    int _detail_tiles = 0;
+};
+}
+
+#endif /* !CHUNKGRID_HPP */
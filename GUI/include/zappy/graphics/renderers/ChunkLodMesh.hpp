@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Far chunks drawn as one box each, colored by a per-tile density texture
+*/
+
+#ifndef CHUNKLODMESH_HPP
+#define CHUNKLODMESH_HPP
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+
+namespace zappy::graphics::renderers {
+class ChunkLodMesh {
+public:
+    ChunkLodMesh() = default;
+    ~ChunkLodMesh();
+    ChunkLodMesh(const ChunkLodMesh&) = delete;
+    ChunkLodMesh& operator=(const ChunkLodMesh&) = delete;
+
+    // False when the map does not fit in a texture or buffers are missing
+    bool build(int width, int height, float tile_size, float tile_height);
+    void release();
+    bool isBuilt() const { return _vertex_buffer != 0; }
+    bool matches(int width, int height, float tile_size, float tile_height) const;
+
+    // One texel per tile, only the changed rows are uploaded
+    void setTileColor(int x, int y, const sf::Color& color);
+    void uploadDirtyTexels();
+
+    // Chunks of a grid of the same size
+    void draw(const std::vector<int>& chunks) const;
+
+    static constexpr int VERTICES_PER_CHUNK = 30;   // Dessus et 4 côtés, 2 triangles chacun
+
+private:
+    struct Vertex {
+        float x, y, z;
+        float u, v;
+        sf::Color shade;
+    };
+
+    void appendChunk(int chunk, std::vector<Vertex>& vertices) const;
+
+    GLuint _vertex_buffer = 0;
+    GLuint _texture = 0;
+
+    int _width = 0;
+    int _height = 0;
+    float _tile_size = 0.0f;
+    float _tile_height = 0.0f;
+    ChunkGrid _layout;
+
+    std::vector<sf::Color> _texels;      // Copie CPU de la texture de densité
+    int _dirty_first_row = 0;
+    int _dirty_end_row = 0;
+
+    // Scratch for glMultiDrawArrays
+    mutable std::vector<GLint> _firsts;
+    mutable std::vector<GLsizei> _counts;
+};
+}
+
+#endif /* !CHUNKLODMESH_HPP */
@@ -16,6 +16,7 @@
 #include "zappy/graphics/utils/MathUtils.hpp"
 #include "zappy/game/entities/CreeperModel.hpp"
 #include "zappy/graphics/utils/TextureManager.hpp"
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
 
 
 namespace zappy::graphics::renderers {
@@ -32,6 +33,8 @@ public:
         float indicator_distance = 0.3f;
         sf::Color indicator_color = sf::Color(255, 255, 100);
         
+        float point_size = 4.0f;              // Joueurs des chunks lointains, en pixels
+        
         bool smooth_movement = false;
         bool level_scaling = false;
         float brightness_factor = 1.0f;
@@ -42,14 +45,20 @@ public:
     ~EntityRenderer();
     
     void initialize(zappy::graphics::utils::TextureManager* texture_manager = nullptr);
+    void shutdown();
     void setConfig(const EntityConfig& config) { _config = config; }
     EntityConfig getConfig() const { return _config; }
     
+    // Players outside the visible chunks are skipped
+    void setChunkGrid(const ChunkGrid* chunks) { _chunks = chunks; }
+    
     // Core rendering methods
     void renderPlayer(const zappy::game::entities::ZappyPlayer& player);
     void renderDirectionIndicator(const zappy::game::entities::ZappyPlayer& player);
     
-    void renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players);
+    // skip_player_id : joueur caché, celui de la vue FPS
+    void renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+                       int skip_player_id = -1);
     void renderPlayersRange(const std::map<int, zappy::game::entities::ZappyPlayer>& players, 
                            int start_id, int end_id);
     
@@ -94,6 +103,9 @@ private:
     MathUtils::Vector3f getPlayerPosition(const zappy::game::entities::ZappyPlayer& player) const;
     MathUtils::Vector3f getIndicatorPosition(const zappy::game::entities::ZappyPlayer& player) const;
     void applyBrightness(sf::Color& color) const;
+    void collectVisiblePlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+                               int skip_player_id);
+    void renderPlayerPoints(const std::vector<const zappy::game::entities::ZappyPlayer*>& players);
     
     EntityConfig _config;
     
@@ -103,6 +115,17 @@ private:
     // Support Creeper avec texture
     zappy::game::entities::CreeperModel* _creeper_model = nullptr;
     float _last_delta_time = 0.016f; // ~60 FPS default
+    
+    const ChunkGrid* _chunks = nullptr;
+    std::vector<std::vector<const zappy::game::entities::ZappyPlayer*>> _player_bins;  // Joueurs par chunk
+    std::vector<const zappy::game::entities::ZappyPlayer*> _visible_players;
+    std::vector<const zappy::game::entities::ZappyPlayer*> _far_players;      // Dessinés en points
+    
+    struct PointVertex {
+        float x, y, z;
+        sf::Color color;
+    };
+    std::vector<PointVertex> _points;
 };
 }
 #endif /* !ENTITYRENDERER_HPP */
\ No newline at end of file
@@ -12,11 +12,14 @@
 #include <SFML/OpenGL.hpp>
 #include <vector>
 #include <map>
+#include <cstdint>
 #include "zappy/game/world/Tile.hpp"
 #include "zappy/game/entities/Player.hpp"
 #include "zappy/graphics/utils/TextureManager.hpp"
 #include "zappy/graphics/renderers/TerrainRenderer.hpp"
 #include "zappy/graphics/renderers/EntityRenderer.hpp"
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+#include "zappy/graphics/utils/Frustum.hpp"
 
 namespace zappy::graphics::renderers {
 class Renderer3D {
@@ -28,9 +31,15 @@ public:
         bool depth_testing = true;
         bool face_culling = false;
         
-        bool frustum_culling = false;
+        bool frustum_culling = true;       // Terrain, resources and players of hidden chunks skipped
         bool batch_rendering = false;
         
+        // Level of detail, from the on-screen size of a tile (zoom included).
+        // It needs the frustum, so it also culls the hidden chunks.
+        bool level_of_detail = true;
+        float lod_points_below = 12.0f;    // Pixels par tile : joueurs en points
+        float lod_aggregate_below = 6.0f;  // Pixels par tile : une boîte par chunk
+        
         bool wireframe_mode = false;
         bool show_normals = false;
     };
@@ -50,8 +59,22 @@ public:
     void renderTileHighlight(int x, int z);
     void renderTile(int x, int z, const zappy::game::world::ZappyTile& tile);
     void renderPlayer(const zappy::game::entities::ZappyPlayer& player);
-    void renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map);
-    void renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players);
+    void renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                       std::uint64_t generation = 0,
+                       const zappy::game::world::TileChanges* changes = nullptr);
+    void renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+                       int skip_player_id = -1);
+    
+    // Chunk visibility for this frame, call once the camera matrices are set
+    void updateVisibility(const zappy::graphics::utils::Frustum& frustum, int map_width, int map_height);
+    const ChunkGrid& getChunkGrid() const { return _chunks; }
+    
+    // Time of the 3D passes: CPU submission, and GPU execution when timer queries exist
+    void beginSceneTimer();
+    void endSceneTimer();
+    float getSceneCpuMs() const { return _scene_cpu_ms; }
+    float getSceneGpuMs() const { return _scene_gpu_ms; }
+    bool hasGpuTimer() const { return _timer_queries[0] != 0; }
     
     zappy::graphics::utils::TextureManager* getTextureManager() { return &_texture_manager; }
     zappy::graphics::renderers::TerrainRenderer* getTerrainRenderer() { return &_terrain_renderer; }
@@ -63,6 +86,7 @@ public:
     void enableWireframe() { _config.wireframe_mode = true; }
     void disableWireframe() { _config.wireframe_mode = false; }
     void toggleWireframe() { _config.wireframe_mode = !_config.wireframe_mode; }
+    void toggleLevelOfDetail() { _config.level_of_detail = !_config.level_of_detail; }
     
     void printRenderingStatistics() const;
 
@@ -75,6 +99,14 @@ private:
     zappy::graphics::utils::TextureManager _texture_manager;
     zappy::graphics::renderers::TerrainRenderer _terrain_renderer;
     zappy::graphics::renderers::EntityRenderer _entity_renderer;
+    zappy::graphics::renderers::ChunkGrid _chunks;
+    
+    sf::Clock _scene_clock;
+    GLuint _timer_queries[2] = {0, 0};  // Lue une frame plus tard pour ne pas bloquer
+    bool _timer_pending[2] = {false, false};
+    int _timer_index = 0;
+    float _scene_cpu_ms = 0.0f;
+    float _scene_gpu_ms = 0.0f;
     
     bool _initialized = false;
 };
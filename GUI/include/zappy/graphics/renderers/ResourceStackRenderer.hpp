@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Resource stacks of the whole map drawn as instances of one cube
+*/
+
+#ifndef RESOURCESTACKRENDERER_HPP
+#define RESOURCESTACKRENDERER_HPP
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "zappy/game/world/Tile.hpp"
+#include "zappy/game/world/TileChanges.hpp"
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+
+namespace zappy::graphics::renderers {
+class ResourceStackRenderer {
+public:
+    static constexpr int RESOURCE_TYPES = 7;
+
+    // Everything that changes the instances of every tile at once
+    struct StackStyle {
+        float cube_size = 0.0f;
+        float cube_height = 0.0f;
+        float radius = 0.0f;             // Distance of the stacks to the tile center
+        float base_y = 0.0f;             // Top of the terrain
+        int max_stack_height = 0;
+        std::array<sf::Color, RESOURCE_TYPES> colors;
+
+        bool operator==(const StackStyle& other) const;
+    };
+
+public:
+    ResourceStackRenderer() = default;
+    ~ResourceStackRenderer();
+    ResourceStackRenderer(const ResourceStackRenderer&) = delete;
+    ResourceStackRenderer& operator=(const ResourceStackRenderer&) = delete;
+
+    // False when the context has no instancing, the caller keeps the immediate path
+    bool initialize();
+    void release();
+    bool isReady() const { return _program != 0; }
+
+    // Only tiles whose cube counts changed get new instances. changes, when
+    // it applies to the last update, limits the comparison to its tiles.
+    void update(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                std::uint64_t generation, const StackStyle& style,
+                const zappy::game::world::TileChanges* changes = nullptr);
+    // visible: chunks of a grid of the map size, nullptr draws every stack.
+    // detail_only leaves out the aggregated chunks.
+    void draw(const ChunkGrid* visible = nullptr, bool detail_only = false) const;
+
+    size_t getInstanceCount() const { return _instances.size(); }
+
+private:
+    struct Instance {
+        float x, y, z;
+        sf::Color color;
+    };
+    using CubeCounts = std::array<std::uint8_t, RESOURCE_TYPES>;
+
+    CubeCounts countCubes(const zappy::game::world::ZappyTile& tile) const;
+    void appendTileInstances(int x, int z, const CubeCounts& cubes, std::vector<Instance>& out) const;
+    void rebuild(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map);
+    void patch(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+               const zappy::game::world::TileChanges* changes);
+    void upload(bool resized);
+    void drawInstances(size_t first, size_t count) const;
+
+    GLuint _program = 0;
+    GLint _size_location = -1;
+    GLuint _vertex_array = 0;
+    GLuint _cube_buffer = 0;
+    GLuint _instance_buffer = 0;
+    size_t _instance_capacity = 0;       // Instances the GPU buffer can hold
+
+    StackStyle _style;
+    bool _stale = true;
+    std::uint64_t _generation = 0;
+    int _width = 0;
+    int _height = 0;
+    ChunkGrid _layout;                    // Instances rangées chunk par chunk
+
+    std::vector<CubeCounts> _tile_cubes;  // Cubes par ressource, pour chaque slot
+    std::vector<size_t> _tile_offsets;    // First instance of each slot, plus the end
+    std::vector<Instance> _instances;     // Copie CPU du buffer d'instances
+    std::vector<std::pair<size_t, size_t>> _dirty_ranges;
+};
+}
+
+#endif /* !RESOURCESTACKRENDERER_HPP */
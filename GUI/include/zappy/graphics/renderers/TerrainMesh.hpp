@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Terrain geometry kept in GPU buffers, built once per map size
+*/
+
+#ifndef TERRAINMESH_HPP
+#define TERRAINMESH_HPP
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+
+namespace zappy::graphics::renderers {
+class TerrainMesh {
+public:
+    TerrainMesh() = default;
+    ~TerrainMesh();
+    TerrainMesh(const TerrainMesh&) = delete;
+    TerrainMesh& operator=(const TerrainMesh&) = delete;
+
+    // Positions, normals, atlas coordinates and indices never change after build.
+    // Tiles are stored chunk by chunk so that a chunk is one range of indices.
+    bool build(int width, int height, float tile_size, float tile_height);
+    void release();
+    bool isBuilt() const { return _vertex_buffer != 0; }
+    bool matches(int width, int height, float tile_size, float tile_height) const;
+
+    // Colors live in their own buffer, only the changed tiles are uploaded
+    bool setTileColors(int x, int y, const sf::Color& top, const sf::Color& side);
+    void uploadDirtyColors();
+
+    // visible: chunks of a grid of the same size, nullptr draws the whole map.
+    // detail_only leaves out the aggregated chunks.
+    void drawFaces(bool textured, const ChunkGrid* visible = nullptr, bool detail_only = false) const;
+    void drawOutlines(const sf::Color& color, float line_width, const ChunkGrid* visible = nullptr,
+                      bool detail_only = false) const;
+
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+
+    static constexpr int VERTICES_PER_TILE = 24;   // 6 faces de 4 sommets
+    static constexpr int FACE_INDICES_PER_TILE = 36;
+    static constexpr int OUTLINE_INDICES_PER_TILE = 24;
+
+private:
+    struct Vertex {
+        float x, y, z;
+        float nx, ny, nz;
+        float u, v;
+    };
+
+    void appendTile(int x, int z, std::vector<Vertex>& vertices,
+                    std::vector<GLuint>& faces, std::vector<GLuint>& outlines) const;
+    void drawElements(GLenum mode, GLuint buffer, int indices_per_tile, const ChunkGrid* visible,
+                      bool detail_only) const;
+
+    GLuint _vertex_buffer = 0;
+    GLuint _color_buffer = 0;
+    GLuint _face_buffer = 0;
+    GLuint _outline_buffer = 0;
+
+    int _width = 0;
+    int _height = 0;
+    float _tile_size = 0.0f;
+    float _tile_height = 0.0f;
+    ChunkGrid _layout;
+
+    std::vector<sf::Color> _colors;      // RGBA par sommet, copie du buffer GPU
+    std::vector<int> _dirty_tiles;       // Slots to upload, in slot order
+};
+}
+
+#endif /* !TERRAINMESH_HPP */
@@ -11,8 +11,14 @@
 #include <SFML/OpenGL.hpp>
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include <cstdint>
 #include "zappy/game/world/Tile.hpp"
+#include "zappy/game/world/TileChanges.hpp"
 #include "zappy/graphics/utils/TextureManager.hpp"
+#include "zappy/graphics/renderers/TerrainMesh.hpp"
+#include "zappy/graphics/renderers/ResourceStackRenderer.hpp"
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+#include "zappy/graphics/renderers/ChunkLodMesh.hpp"
 
 namespace zappy::graphics::renderers {
 class TerrainRenderer {
@@ -25,8 +31,8 @@ public:
         bool use_textures = true;
         bool texture_filtering = true;
         
-        bool frustum_culling = false;
-        bool batched_rendering = false;
+        bool frustum_culling = true;       // Skip the chunks outside the camera frustum
+        bool batched_rendering = true;     // Terrain from GPU buffers instead of glBegin per face
         float brightness_boost = 1.0f;
         bool color_variation = false;
         
@@ -59,14 +65,21 @@ public:
     ~TerrainRenderer() = default;
     
     void initialize(zappy::graphics::utils::TextureManager* texture_manager);
-    void setConfig(const TerrainConfig& config) { _config = config; }
+    void shutdown();
+    void setConfig(const TerrainConfig& config) { _config = config; _mesh_stale = true; }
     TerrainConfig getConfig() const { return _config; }
     
+    // Visibility of the map chunks, updated by Renderer3D each frame
+    void setChunkGrid(const ChunkGrid* chunks) { _chunks = chunks; }
+    
     void renderTile(int x, int z, const zappy::game::world::ZappyTile& tile);
     void renderEmptyTile(float x, float y, float z);
     void renderResourceTile(float x, float y, float z, const sf::Color& color);
     
     // Resource rendering methods
+    void renderResourceMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                           std::uint64_t generation = 0,
+                           const zappy::game::world::TileChanges* changes = nullptr);
     void renderResourceStacks(float x, float y, float z, const zappy::game::world::ZappyTile& tile);
     void renderResourceStack(float center_x, float center_y, float center_z,
                            int count, const sf::Color& color,
@@ -74,7 +87,11 @@ public:
     void renderResourceCube(float x, float y, float z, float size, float height, 
                            const sf::Color& color);
     
-    void renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map);
+    // generation identifies the map content, 0 rescans the tile colors every call.
+    // changes, when given, limits the rescan to the tiles it marks.
+    void renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                       std::uint64_t generation = 0,
+                       const zappy::game::world::TileChanges* changes = nullptr);
     void renderTileRange(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
                         int start_x, int start_z, int end_x, int end_z);
     
@@ -113,6 +130,20 @@ private:
     void setupTexturedRendering();
     void setupColoredRendering();
     
+    // Batched terrain
+    bool renderTerrainMesh(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                           std::uint64_t generation, const zappy::game::world::TileChanges* changes);
+    void refreshTerrainColors(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+                              bool textured, const zappy::game::world::TileChanges* changes);
+    void refreshTileColor(const zappy::game::world::ZappyTile& tile, int x, int z, bool textured);
+    void computeTileColors(const zappy::game::world::ZappyTile& tile, bool textured,
+                           sf::Color& top, sf::Color& side) const;
+    sf::Color computeDensityColor(const zappy::game::world::ZappyTile& tile) const;
+    bool prepareLodMesh(const ChunkGrid* visible, int width, int height);
+    ResourceStackRenderer::StackStyle resourceStackStyle() const;
+    const ChunkGrid* visibleChunks(int width, int height) const;
+    void renderVisibleTiles(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map, bool resources_only);
+    
     TerrainConfig _config;
     
     zappy::graphics::utils::TextureManager* _texture_manager = nullptr;
@@ -122,6 +153,19 @@ private:
     
     size_t _tiles_rendered = 0;
     
+    TerrainMesh _mesh;
+    bool _mesh_failed = false;          // Buffers unavailable, stay on the immediate path
+    bool _mesh_stale = true;            // Colors must be recomputed for every tile
+    bool _mesh_textured = false;
+    std::uint64_t _mesh_generation = 0;
+    
+    ResourceStackRenderer _resource_stacks;
+    const ChunkGrid* _chunks = nullptr;
+    
+    ChunkLodMesh _lod_mesh;
+    bool _lod_failed = false;           // Carte trop grande pour une texture
+    bool _lod_drawn = false;            // Aggregated chunks drawn this frame, resources skip them
+    
     enum CubeFace {
         FACE_TOP = 0,
         FACE_BOTTOM,
@@ -13,6 +13,7 @@
 #include <map>
 #include <string>
 #include "zappy/game/world/Tile.hpp"
+#include "zappy/game/world/PlayerBuckets.hpp"
 #include "zappy/game/entities/Player.hpp"
 
 namespace zappy::graphics::renderers {
@@ -21,13 +22,13 @@ public:
     struct UIConfig {
         // Stats panel - minimal
         sf::Vector2f stats_panel_position = sf::Vector2f(10, 10);
-        sf::Vector2f stats_panel_size = sf::Vector2f(300, 150);
+        sf::Vector2f stats_panel_size = sf::Vector2f(300, 200);
         sf::Color stats_panel_color = sf::Color(0, 0, 0, 120);
         sf::Color stats_panel_outline = sf::Color::White;
         float stats_panel_outline_thickness = 1.0f;
         
         // Tile info panel
-        sf::Vector2f tile_info_panel_position = sf::Vector2f(10, 180);
+        sf::Vector2f tile_info_panel_position = sf::Vector2f(10, 230);
         sf::Vector2f tile_info_panel_size = sf::Vector2f(280, 300);
         sf::Color tile_info_panel_color = sf::Color(0, 0, 50, 140);
         sf::Color tile_info_panel_outline = sf::Color::Cyan;
@@ -63,6 +64,14 @@ public:
         float rotation_degrees = 0.0f;
         
         int total_resources = 0; // Simplifié
+        
+        // Temps des passes 3D, moyenné séparément avec et sans LOD
+        float scene_time_ms = 0.0f;
+        bool lod_enabled = false;
+        float lod_on_time_ms = 0.0f;       // 0 : pas encore mesuré
+        float lod_off_time_ms = 0.0f;
+        int detailed_chunks = 0;
+        int aggregated_chunks = 0;
     };
     
     struct TileInfo {
@@ -101,9 +110,11 @@ public:
                                 const std::map<int, zappy::game::entities::ZappyPlayer>& players,
                                 float fps, float zoom, float rotation) const;
     
+    // Players on the tile come from buckets, built from the same players map
     TileInfo createTileInfo(int x, int y, 
                            const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
-                           const std::map<int, zappy::game::entities::ZappyPlayer>& players) const;
+                           const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+                           const zappy::game::world::PlayerBuckets& buckets) const;
     
     PlayerInfo createPlayerInfo(int player_id, 
                                const std::map<int, zappy::game::entities::ZappyPlayer>& players) const;
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <iostream>
 #include "zappy/graphics/utils/MathUtils.hpp"
+#include "zappy/graphics/utils/Frustum.hpp"
 #include "zappy/game/entities/Player.hpp"
 
 #ifndef M_PI
@@ -82,6 +83,9 @@ public:
     void setupCamera();
     void resetMatrices();
     
+    // Frustum of the last setupProjection + setupCamera
+    const Frustum& getFrustum() const { return _frustum; }
+    
     // Contrôle du FOV
     void setFOV(float fov) { _base_fov = fov; }
     float getFOV() const { return _base_fov; }
@@ -104,6 +108,7 @@ private:
     
     // === COMMON ===
     CameraMode _camera_mode = CameraMode::ORBITAL;
+    Frustum _frustum;
     
     // === ORBITAL MODE ===
     float _rotation_angle = 0.0f;
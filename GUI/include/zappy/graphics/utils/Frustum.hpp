@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** View frustum planes for visibility tests
+*/
+
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#include <SFML/OpenGL.hpp>
+#include <array>
+#include "zappy/graphics/utils/MathUtils.hpp"
+
+namespace zappy::graphics::utils {
+class Frustum {
+public:
+    Frustum() = default;
+    ~Frustum() = default;
+
+    // Planes of the current GL_PROJECTION * GL_MODELVIEW, in world space
+    void extractFromGL();
+    bool isValid() const { return _valid; }
+
+    // Conservative: a box crossing a plane counts as visible
+    bool intersectsBox(const MathUtils::Vector3f& min, const MathUtils::Vector3f& max) const;
+
+    // Camera position and on-screen size of one world unit at a distance,
+    // the zoom of Camera3D narrows the field of view and so enlarges it
+    const MathUtils::Vector3f& getEye() const { return _eye; }
+    float pixelsPerUnit(float distance) const;
+
+private:
+    struct Plane {
+        float a, b, c, d;     // a*x + b*y + c*z + d >= 0 à l'intérieur
+    };
+
+    std::array<Plane, 6> _planes{};
+    bool _valid = false;
+    MathUtils::Vector3f _eye;
+    float _focal_pixels = 0.0f;     // Hauteur du viewport / (2 * tan(fov / 2))
+};
+}
+
+#endif /* !FRUSTUM_HPP */
@@ -46,6 +46,11 @@ struct Mesh {
     std::vector<Face> faces;
     Material material;
     
+    // Range of the mesh in the vertex buffer of its Model, 0 before upload
+    GLuint vertex_buffer = 0;
+    GLint first_vertex = 0;
+    bool has_texcoords = false;
+    
     void render() const;
 };
 
@@ -53,9 +58,18 @@ namespace zappy::graphics::utils {
 class Model {
 public:
     Model() = default;
-    ~Model() = default;
+    ~Model();
+    Model(const Model&) = delete;
+    Model& operator=(const Model&) = delete;
     
     bool loadFromFile(const std::string& filepath);
+    
+    // Every mesh in one interleaved buffer: position, normal, texcoord
+    bool uploadToGPU();
+    void releaseGPU();
+    GLuint getVertexBuffer() const { return _vertex_buffer; }
+    GLsizei getVertexCount() const { return _vertex_count; }
+    static constexpr GLsizei GPU_VERTEX_STRIDE = 8 * sizeof(float);
     void render(const MathUtils::Vector3f& position, 
                const MathUtils::Vector3f& rotation = MathUtils::Vector3f(0, 0, 0),
                const MathUtils::Vector3f& scale = MathUtils::Vector3f(1, 1, 1)) const;
@@ -87,6 +101,8 @@ private:
     std::vector<sf::Vector2f> _obj_texcoords;
     
     MathUtils::Vector3f _bbox_min, _bbox_max;
+    GLuint _vertex_buffer = 0;
+    GLsizei _vertex_count = 0;
     sf::Color _override_color = sf::Color::Transparent;
     bool _wireframe_mode = false;
     bool _loaded = false;
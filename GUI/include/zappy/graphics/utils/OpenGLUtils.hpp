@@ -51,6 +51,13 @@ namespace OpenGLUtils {
     void unbindTexture();
     void deleteTexture(GLuint texture_id);
     
+    // Version of the current context, for the shader and instancing paths
+    bool isVersionAtLeast(int major, int minor);
+    
+    // Returns 0 and logs the compiler output when a stage does not build
+    GLuint createShaderProgram(const char* vertex_source, const char* fragment_source);
+    void deleteShaderProgram(GLuint program);
+    
     void renderQuad(float size = 1.0f);
     void renderCube(float size = 1.0f);
     void setNormal(float x, float y, float z);
@@ -12,6 +12,7 @@
 #include <SFML/OpenGL.hpp>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 
 namespace zappy::graphics::utils{
@@ -23,6 +24,7 @@ public:
         DIRT,
         STONE,
         WATER,
+        TERRAIN_ATLAS,
         CUSTOM
     };
     
@@ -44,6 +46,8 @@ public:
     bool loadCustomTexture(const std::string& name, const std::string& filepath);
     bool loadCustomTexture(const std::string& name, const std::string& filepath,
                           const TextureConfig& config);
+    // Images of the same size side by side, slot i covers u in [i/n, (i+1)/n]
+    bool loadAtlasTexture(TextureType type, const std::vector<std::string>& filepaths);
     void loadDefaultTextures();
     
     GLuint getTexture(TextureType type) const;
@@ -67,6 +71,11 @@ public:
     static constexpr const char* DEFAULT_GRASS_PATH = "assets/textures/grass.png";
     static constexpr const char* DEFAULT_DIRT_PATH = "assets/textures/grass.png";
     
+    // Terrain atlas layout: grass then dirt
+    static constexpr int ATLAS_GRASS_SLOT = 0;
+    static constexpr int ATLAS_DIRT_SLOT = 1;
+    static constexpr int ATLAS_SLOTS = 2;
+    
 private:
     GLuint createTextureFromImage(const sf::Image& image, const TextureConfig& config);
     void applyTextureConfig(const TextureConfig& config);
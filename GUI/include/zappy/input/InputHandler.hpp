@@ -85,6 +85,9 @@ public:
         PlayerSelection player_selection;
         bool player_clicked = false;
         
+        // Level of detail - compare frame times with and without it
+        bool toggle_lod = false;                // Touche [L]
+        
         // Simple Creeper control - just toggle ON/OFF
         bool toggle_creeper_model = false;      // Touche [C] - Activer/désactiver Creeper
         
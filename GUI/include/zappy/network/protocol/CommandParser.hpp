@@ -9,21 +9,51 @@
 #define COMMANDPARSER_HPP_
 
 #include <string>
+#include <string_view>
 #include <vector>
-#include <functional>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <cstdint>
 #include "zappy/game/world/SharedGameState.hpp"
 
 namespace zappy::network::protocol {
+
+// Paramètres d'un message, vues sur le buffer de réception sans copie.
+// Valides uniquement pendant l'appel au handler.
+struct TokenList {
+    static constexpr size_t MAX_TOKENS = 32;
+
+    std::string_view tokens[MAX_TOKENS];
+    size_t count = 0;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::string_view operator[](size_t index) const { return tokens[index]; }
+    const std::string_view* begin() const { return tokens; }
+    const std::string_view* end() const { return tokens + count; }
+};
+
 class CommandParser {
 public:
     explicit CommandParser(std::shared_ptr<zappy::game::world::SharedGameState> game_state);
     ~CommandParser() = default;
     
-    // Parsing principal
-    void parseCommand(const std::string& command, const std::vector<std::string>& parameters);
-    bool isValidCommand(const std::string& command) const;
+    // Parsing principal, message sans le '\n' final
+    void parseMessage(std::string_view message);
+    void parseCommand(std::string_view command, const TokenList& parameters);
+    bool isValidCommand(std::string_view command) const;
+    // Applique les bct accumulés, à appeler après chaque lot de messages
+    void flushTileUpdates();
+
+    // Découpe sur les espaces, le dernier jeton garde la fin de la ligne
+    static void tokenize(std::string_view text, TokenList& tokens);
+    // Les commandes du protocole font 3 caractères, comparées comme un entier
+    static constexpr std::uint32_t opcode(const char* name) {
+        return static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[0]))
+            | static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[1])) << 8
+            | static_cast<std::uint32_t>(static_cast<std::uint8_t>(name[2])) << 16;
+    }
+    static std::uint32_t opcodeOf(std::string_view command);
 
     // Pending commands management
     void addPendingCommand(const std::string& command);
@@ -31,73 +61,89 @@ public:
     bool hasPendingCommands() const;
     
 private:
+    using Handler = void (CommandParser::*)(const TokenList&);
+    struct HandlerEntry {
+        std::uint32_t opcode;
+        Handler handler;
+    };
+
     // Initialisation des handlers
     void setupCommandHandlers();
+    void addHandler(const char* name, Handler handler);
+    Handler findHandler(std::uint32_t opcode) const;
     
     // Handlers pour les commandes du protocole GUI
-    void handleMapSize(const std::vector<std::string>& params);              // msz X Y
-    void handleTileContent(const std::vector<std::string>& params);          // bct X Y q0 q1 q2 q3 q4 q5 q6
-    void handleMapContent(const std::vector<std::string>& params);           // mct (suivi de multiples bct)
-    void handleTeamNames(const std::vector<std::string>& params);            // tna N
+    void handleMapSize(const TokenList& params);              // msz X Y
+    void handleTileContent(const TokenList& params);          // bct X Y q0 q1 q2 q3 q4 q5 q6
+    void handleMapContent(const TokenList& params);           // mct (suivi de multiples bct)
+    void handleTeamNames(const TokenList& params);            // tna N
     
     // Gestion des joueurs
-    void handleNewPlayer(const std::vector<std::string>& params);            // pnw #n X Y O L N
-    void handlePlayerPosition(const std::vector<std::string>& params);       // ppo #n X Y O
-    void handlePlayerLevel(const std::vector<std::string>& params);          // plv #n L
-    void handlePlayerInventory(const std::vector<std::string>& params);      // pin #n X Y q0 q1 q2 q3 q4 q5 q6
-    void handlePlayerExpulsion(const std::vector<std::string>& params);      // pex #n
-    void handlePlayerBroadcast(const std::vector<std::string>& params);      // pbc #n M
-    void handlePlayerDeath(const std::vector<std::string>& params);          // pdi #n
+    void handleNewPlayer(const TokenList& params);            // pnw #n X Y O L N
+    void handlePlayerPosition(const TokenList& params);       // ppo #n X Y O
+    void handlePlayerLevel(const TokenList& params);          // plv #n L
+    void handlePlayerInventory(const TokenList& params);      // pin #n X Y q0 q1 q2 q3 q4 q5 q6
+    void handlePlayerExpulsion(const TokenList& params);      // pex #n
+    void handlePlayerBroadcast(const TokenList& params);      // pbc #n M
+    void handlePlayerDeath(const TokenList& params);          // pdi #n
     
     // Gestion des incantations
-    void handleIncantationStart(const std::vector<std::string>& params);     // pic X Y L #n #n ...
-    void handleIncantationEnd(const std::vector<std::string>& params);       // pie X Y R
+    void handleIncantationStart(const TokenList& params);     // pic X Y L #n #n ...
+    void handleIncantationEnd(const TokenList& params);       // pie X Y R
     
     // Gestion des œufs
-    void handleEggLaying(const std::vector<std::string>& params);            // pfk #n
-    void handleNewEgg(const std::vector<std::string>& params);               // enw #e #n X Y
-    void handleEggConnection(const std::vector<std::string>& params);        // ebo #e
-    void handleEggDeath(const std::vector<std::string>& params);             // edi #e
+    void handleEggLaying(const TokenList& params);            // pfk #n
+    void handleNewEgg(const TokenList& params);               // enw #e #n X Y
+    void handleEggConnection(const TokenList& params);        // ebo #e
+    void handleEggDeath(const TokenList& params);             // edi #e
     
     // Gestion des ressources
-    void handleResourceDrop(const std::vector<std::string>& params);         // pdr #n i
-    void handleResourceTake(const std::vector<std::string>& params);         // pgt #n i
+    void handleResourceDrop(const TokenList& params);         // pdr #n i
+    void handleResourceTake(const TokenList& params);         // pgt #n i
     
     // Gestion du jeu
-    void handleTimeUnit(const std::vector<std::string>& params);             // sgt T
-    void handleTimeUnitSet(const std::vector<std::string>& params);          // sst T
-    void handleEndGame(const std::vector<std::string>& params);              // seg N
-    void handleServerMessage(const std::vector<std::string>& params);        // smg M
+    void handleTimeUnit(const TokenList& params);             // sgt T
+    void handleTimeUnitSet(const TokenList& params);          // sst T
+    void handleEndGame(const TokenList& params);              // seg N
+    void handleServerMessage(const TokenList& params);        // smg M
     
     // Gestion des erreurs
-    void handleUnknownCommand(const std::vector<std::string>& params);       // suc
-    void handleBadParameter(const std::vector<std::string>& params);         // sbp
+    void handleUnknownCommand(const TokenList& params);       // suc
+    void handleBadParameter(const TokenList& params);         // sbp
     
     // Utilitaires de parsing
-    int parseInteger(const std::string& str, const std::string& context = "") const;
-    std::string parseString(const std::string& str) const;
-    std::vector<int> parseResourceList(const std::vector<std::string>& params, 
+    int parseInteger(std::string_view str, const char* context = "") const;
+    std::string parseString(std::string_view str) const;
+    void parseResources(const TokenList& params, size_t start_index,
+        zappy::game::world::ZappyTile& tile) const;
+    // Chemin rapide pour "X Y q0..q6" après bct, false si la ligne doit
+    // passer par le découpage générique
+    static bool parseTileLine(std::string_view text, zappy::game::world::ZappyTile& tile);
+    std::vector<int> parseResourceList(const TokenList& params, 
         size_t start_index) const;
-    std::vector<int> parsePlayerList(const std::vector<std::string>& params, 
+    std::vector<int> parsePlayerList(const TokenList& params, 
         size_t start_index) const;
     
     // Validation
-    bool validateParameters(const std::vector<std::string>& params, 
+    bool validateParameters(const TokenList& params, 
         size_t expected_count, 
-        const std::string& command) const;
+        const char* command) const;
     bool validateCoordinates(int x, int y) const;
     bool validatePlayerId(int player_id) const;
     bool validateOrientation(int orientation) const;
     
     // Logging et debug
-    void logCommand(const std::string& command, 
-        const std::vector<std::string>& params) const;
+    void logCommand(std::string_view command, 
+        const TokenList& params) const;
     void logError(const std::string& message) const;
     void logWarning(const std::string& message) const;
 
     std::shared_ptr<zappy::game::world::SharedGameState> _game_state;
-    // Map des handlers de commandes
-    std::map<std::string, std::function<void(const std::vector<std::string>&)>> _command_handlers;
+    // Handlers indexés par opcode, les plus fréquents en premier
+    std::vector<HandlerEntry> _command_handlers;
+
+    // bct en attente, appliqués ensemble sous un seul verrou
+    std::vector<zappy::game::world::ZappyTile> _tile_batch;
 
     std::vector<std::string> _pending_commands;
     mutable std::mutex _pending_mutex;
@@ -9,6 +9,7 @@
 #define NETWORKMANAGER_HPP_
 
 #include <string>
+#include <string_view>
 #include <thread>
 #include <memory>
 #include <poll.h>
@@ -40,8 +41,10 @@ private:
     int _socket_fd = -1;
     struct pollfd _poll_fds[1];
     
-    // Buffers de communication
+    // Buffers de communication, les lignes sont lues en place à partir de
+    // _read_offset puis le reste est ramené en tête une fois par lot
     std::string _receive_buffer;
+    size_t _read_offset = 0;
     std::queue<std::string> _send_queue;
     std::mutex _send_mutex;
     
@@ -58,6 +61,7 @@ private:
     static constexpr int POLL_TIMEOUT_MS = 100;
     static constexpr int CONNECTION_TIMEOUT_S = 10;
     static constexpr size_t MAX_BUFFER_SIZE = 65536;
+    static constexpr size_t RECEIVE_CHUNK_SIZE = 16384;
 
 public:
     NetworkManager(const std::string& host, int port, 
@@ -99,17 +103,14 @@ private:
     bool receiveData();
     bool sendPendingData();
     void processReceivedData();
-    void processCompleteMessage(const std::string& message);
+    void processCompleteMessage(std::string_view message);
     void requestInitialGameState();
     void processPendingCommands();
     void processCommandParserPendingCommands();
     
-    // Parsing et traitement
-    std::vector<std::string> splitMessage(const std::string& message);
-    
     // Utilitaires
     bool waitForConnection();
-    std::string extractNextMessage();
+    bool extractNextMessage(std::string_view& message);
     void logError(const std::string& message) const;
     void logDebug(const std::string& message) const;
 };
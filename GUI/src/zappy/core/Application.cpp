@@ -11,6 +11,7 @@
 #include <SFML/OpenGL.hpp>
 #include <GL/glu.h>
 #include <iomanip>
+#include <algorithm>
 
 zappy::core::Application::Application(std::shared_ptr<zappy::game::world::SharedGameState> shared_state)
     : _shared_state(shared_state)
@@ -18,6 +19,7 @@ zappy::core::Application::Application(std::shared_ptr<zappy::game::world::Shared
     if (!_shared_state) {
         throw std::runtime_error("SharedGameState cannot be null");
     }
+    _snapshot = _shared_state->getSnapshot();
     
     std::cout << "🚀 Zappy 3D Application created with SharedGameState and simple FPS support" << std::endl;
 }
@@ -158,6 +160,9 @@ void zappy::core::Application::update(float deltaTime)
 {
     (void)deltaTime; // Suppress unused parameter warning
     
+    // Take the latest published state once, every reader below shares it
+    refreshSnapshot();
+    
     // Update camera based on current game state
     updateCameraFromGameState();
     
@@ -183,32 +188,26 @@ void zappy::core::Application::render()
     _camera.setupProjection(_window.getSize().x, _window.getSize().y);
     _camera.setupCamera();
     
-    // Get current state from SharedGameState
-    auto world_map = getWorldMapSafe();
-    auto players_map = getPlayersSafe();
+    // Current state published by the network thread
+    const auto& world_map = _snapshot->world_map;
+    const auto& players_map = _snapshot->players;
     
     // Only render if we have a valid map
+    _renderer.beginSceneTimer();
     if (!world_map.empty() && !world_map[0].empty()) {
+        // 0. Chunks outside the camera frustum are skipped by every pass below
+        _renderer.updateVisibility(_camera.getFrustum(), static_cast<int>(world_map[0].size()),
+                                   static_cast<int>(world_map.size()));
+        
         // 1. Render the terrain with grid
         auto* terrain_renderer = _renderer.getTerrainRenderer();
         if (terrain_renderer) {
-            _renderer.renderTileMap(world_map);
+            _renderer.renderTileMap(world_map, _snapshot->generation, &_snapshot->tile_changes);
         }
         
         // 2. Render resources on tiles
         if (terrain_renderer) {
-            for (int y = 0; y < static_cast<int>(world_map.size()); y++) {
-                for (int x = 0; x < static_cast<int>(world_map[y].size()); x++) {
-                    if (world_map[y][x].getTotalResources() > 0) {
-                        terrain_renderer->renderResourceStacks(
-                            static_cast<float>(x), 
-                            0.0f,
-                            static_cast<float>(y), 
-                            world_map[y][x]
-                        );
-                    }
-                }
-            }
+            terrain_renderer->renderResourceMap(world_map, _snapshot->generation, &_snapshot->tile_changes);
         }
         
         // 3. Render players (but not the FPS target player from inside view)
@@ -218,6 +217,7 @@ void zappy::core::Application::render()
             _renderer.renderPlayers(players_map);
         }
     }
+    _renderer.endSceneTimer();
     
     // 4. UI with tile and player info
     _camera.resetMatrices();
@@ -226,6 +226,7 @@ void zappy::core::Application::render()
     auto stats = _ui_renderer.calculateGameStats(world_map, players_map, 
                                                 _current_fps, _camera.getZoom(), 
                                                 _camera.getRotation());
+    fillSceneStats(stats);
     
     bool has_tile_info = _current_tile_selection.has_selection;
     bool has_player_info = _current_player_selection.has_selection;
@@ -243,16 +244,27 @@ void zappy::core::Application::render()
     _window.display();
 }
 
+void zappy::core::Application::fillSceneStats(zappy::graphics::renderers::UIRenderer::GameStats& stats)
+{
+    const auto& chunks = _renderer.getChunkGrid();
+    bool lod = _renderer.getConfig().level_of_detail;
+    float scene_ms = std::max(_renderer.getSceneCpuMs(), _renderer.getSceneGpuMs());
+    float& average = _scene_time_by_lod[lod ? 1 : 0];
+    
+    // Moyenne sur une trentaine de frames, la première mesure sert de départ
+    average = (average > 0.0f) ? average + (scene_ms - average) * 0.05f : scene_ms;
+    stats.scene_time_ms = scene_ms;
+    stats.lod_enabled = lod;
+    stats.lod_off_time_ms = _scene_time_by_lod[0];
+    stats.lod_on_time_ms = _scene_time_by_lod[1];
+    stats.aggregated_chunks = static_cast<int>(chunks.getAggregatedChunks().size());
+    stats.detailed_chunks = static_cast<int>(chunks.getVisibleChunks().size()) - stats.aggregated_chunks;
+}
+
 void zappy::core::Application::renderPlayersExceptFPSTarget(const std::map<int, zappy::game::entities::ZappyPlayer>& players)
 {
-    int fps_target = _camera.getFPSTarget();
-    
-    for (const auto& pair : players) {
-        // Don't render the player we're viewing from in FPS mode
-        if (pair.first != fps_target) {
-            _renderer.renderPlayer(pair.second);
-        }
-    }
+    // Don't render the player we're viewing from in FPS mode
+    _renderer.renderPlayers(players, _camera.getFPSTarget());
 }
 
 void zappy::core::Application::shutdown()
@@ -270,8 +282,8 @@ void zappy::core::Application::shutdown()
 
 void zappy::core::Application::updateCameraFromGameState()
 {
-    int map_width = _shared_state->getMapWidth();
-    int map_height = _shared_state->getMapHeight();
+    int map_width = _snapshot->map_width;
+    int map_height = _snapshot->map_height;
     
     if (map_width > 0 && map_height > 0) {
         _camera.setMapSize(map_width, map_height);
@@ -280,13 +292,19 @@ void zappy::core::Application::updateCameraFromGameState()
 
 void zappy::core::Application::updateSelectionsFromGameState()
 {
-    auto world_map = getWorldMapSafe();
-    auto players_map = getPlayersSafe();
+    if (_snapshot->generation == _selection_generation) {
+        return;
+    }
+    _selection_generation = _snapshot->generation;
+    
+    const auto& world_map = _snapshot->world_map;
+    const auto& players_map = _snapshot->players;
     
     // Update tile selection if it exists
     if (_current_tile_selection.has_selection && !world_map.empty()) {
         _current_tile_selection = _ui_renderer.createTileInfo(
-            _current_tile_selection.x, _current_tile_selection.y, world_map, players_map);
+            _current_tile_selection.x, _current_tile_selection.y, world_map, players_map,
+            _snapshot->player_buckets);
     }
     
     // Update player selection if it exists
@@ -298,9 +316,10 @@ void zappy::core::Application::updateSelectionsFromGameState()
 
 void zappy::core::Application::processGameEvents()
 {
-    auto events = _shared_state->getAndClearEvents();
+    // File sans verrou, _game_events garde sa capacité d'une frame à l'autre
+    _shared_state->drainEvents(_game_events);
     
-    for (const auto& event : events) {
+    for (const auto& event : _game_events) {
         switch (event.type) {
             case zappy::game::world::GameEvent::PLAYER_MOVED:
                 std::cout << "👤 Player " << event.player_id << " moved to (" 
@@ -308,7 +327,7 @@ void zappy::core::Application::processGameEvents()
                 
                 // If we're in FPS mode and this is our target player, update camera position
                 if (_camera.isFPSMode() && _camera.getFPSTarget() == event.player_id) {
-                    auto players_map = getPlayersSafe();
+                    const auto& players_map = _snapshot->players;
                     auto player_it = players_map.find(event.player_id);
                     if (player_it != players_map.end()) {
                         _camera.setFPSFromPlayer(player_it->second);
@@ -318,7 +337,7 @@ void zappy::core::Application::processGameEvents()
                 
             case zappy::game::world::GameEvent::PLAYER_LEVELED:
                 std::cout << "📈 Player " << event.player_id << " reached level " 
-                         << event.data.at("level") << std::endl;
+                         << event.level << std::endl;
                 break;
                 
             case zappy::game::world::GameEvent::RESOURCE_CHANGED:
@@ -332,40 +351,34 @@ void zappy::core::Application::processGameEvents()
                 break;
                 
             case zappy::game::world::GameEvent::INCANTATION_ENDED:
-                std::cout << "✨ Incantation ended: " << event.message << std::endl;
+                std::cout << "✨ Incantation ended: " << _shared_state->getEventString(event.message) << std::endl;
                 break;
                 
             case zappy::game::world::GameEvent::BROADCAST_RECEIVED:
                 if (event.player_id >= 0) {
-                    std::cout << "📢 Player " << event.player_id << " broadcasts: " << event.message << std::endl;
+                    std::cout << "📢 Player " << event.player_id << " broadcasts: "
+                              << _shared_state->getEventText(event.text) << std::endl;
                 } else {
-                    std::cout << "📢 Server message: " << event.message << std::endl;
+                    std::cout << "📢 Server message: " << _shared_state->getEventText(event.text) << std::endl;
                 }
                 break;
                 
             default:
                 break;
         }
+        // Rend le slot de texte au thread réseau
+        _shared_state->releaseEventText(event.text);
     }
 }
 
-// === HELPER METHODS FOR THREAD-SAFE ACCESS ===
-
-std::vector<std::vector<zappy::game::world::ZappyTile>> zappy::core::Application::getWorldMapSafe() const
-{
-    return _shared_state->getWorldMap();
-}
+// === SNAPSHOT ACCESS ===
 
-std::map<int, zappy::game::entities::ZappyPlayer> zappy::core::Application::getPlayersSafe() const
+void zappy::core::Application::refreshSnapshot()
 {
-    std::map<int, zappy::game::entities::ZappyPlayer> players_map;
-    auto players_vector = _shared_state->getPlayers();
-    
-    for (const auto& player : players_vector) {
-        players_map[player.id] = player;
-    }
-    
-    return players_map;
+    // Lecture sans verrou : le thread réseau ne modifie jamais un snapshot publié
+    _snapshot = _shared_state->getSnapshot();
+    // Les prochains tile_changes peuvent partir de cette génération
+    _shared_state->acknowledgeGeneration(_snapshot->generation);
 }
 
 // === SELECTION METHODS ===
@@ -383,6 +396,10 @@ void zappy::core::Application::processInputActions()
         handleFPSModeToggle();
     }
     
+    if (input_state.toggle_lod) {
+        _renderer.toggleLevelOfDetail();
+    }
+    
     // Selection logic
     if (input_state.player_clicked || input_state.tile_clicked) {
         handlePrioritySelection(input_state);
@@ -395,7 +412,7 @@ void zappy::core::Application::handleFPSModeToggle()
         // Trying to enter FPS mode
         if (_current_player_selection.has_selection) {
             // We have a selected player, enter FPS mode
-            auto players_map = getPlayersSafe();
+            const auto& players_map = _snapshot->players;
             auto player_it = players_map.find(_current_player_selection.player_id);
             
             if (player_it != players_map.end()) {
@@ -440,7 +457,7 @@ void zappy::core::Application::handlePrioritySelection(const zappy::input::Input
         int tile_y = input_state.tile_selection.tile_y;
         
         // Get current map dimensions
-        auto world_map = getWorldMapSafe();
+        const auto& world_map = _snapshot->world_map;
         int map_width = world_map.empty() ? 0 : static_cast<int>(world_map[0].size());
         int map_height = static_cast<int>(world_map.size());
         
@@ -455,7 +472,7 @@ void zappy::core::Application::handlePrioritySelection(const zappy::input::Input
 
 bool zappy::core::Application::trySelectPlayerAtPosition(const sf::Vector2i& screen_pos)
 {    
-    auto players_map = getPlayersSafe();
+    const auto& players_map = _snapshot->players;
     if (players_map.empty()) {
         return false;
     }
@@ -522,13 +539,27 @@ bool zappy::core::Application::trySelectPlayerAtPosition(const sf::Vector2i& scr
     float closest_distance = 0.8f + 1.0f; // player_selection_radius + margin
     const float PLAYER_SELECTION_RADIUS = 0.8f;
     
-    for (const auto& player_pair : players_map) {
-        const zappy::game::entities::ZappyPlayer& player = player_pair.second;
-        float distance = calculateDistanceToPlayer(intersection, player);
-        
-        if (distance < PLAYER_SELECTION_RADIUS && distance < closest_distance) {
-            closest_player_id = player.id;
-            closest_distance = distance;
+    // Les joueurs sont au centre de leur tile et le rayon de sélection fait
+    // moins d'une tile : seules la cellule touchée et ses voisines comptent
+    int hit_x = static_cast<int>(std::round(intersection.x));
+    int hit_z = static_cast<int>(std::round(intersection.z));
+    const auto& buckets = _snapshot->player_buckets;
+    
+    for (int z = hit_z - 1; z <= hit_z + 1; z++) {
+        for (int x = hit_x - 1; x <= hit_x + 1; x++) {
+            buckets.forEachOnTile(x, z, [&](int player_id) {
+                auto player_it = players_map.find(player_id);
+                if (player_it == players_map.end()) {
+                    return;
+                }
+                float distance = calculateDistanceToPlayer(intersection, player_it->second);
+                
+                if (distance < PLAYER_SELECTION_RADIUS && (distance < closest_distance ||
+                    (distance == closest_distance && player_id < closest_player_id))) {
+                    closest_player_id = player_id;
+                    closest_distance = distance;
+                }
+            });
         }
     }
     
@@ -554,9 +585,10 @@ void zappy::core::Application::handleTileSelection(int x, int y)
     _current_player_selection.has_selection = false;
     
     // Create tile info
-    auto world_map = getWorldMapSafe();
-    auto players_map = getPlayersSafe();
-    _current_tile_selection = _ui_renderer.createTileInfo(x, y, world_map, players_map);
+    const auto& world_map = _snapshot->world_map;
+    const auto& players_map = _snapshot->players;
+    _current_tile_selection = _ui_renderer.createTileInfo(x, y, world_map, players_map,
+                                                          _snapshot->player_buckets);
     
     if (_current_tile_selection.has_selection) {
         //std::cout << "🎯 Tile (" << x << ", " << y << ") selected" << std::endl;
@@ -11,8 +11,51 @@
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <random>
 
+namespace {
+
+// Même transformation que renderCreeperModel : échelle, rotation en Y, translation
+const char* CREEPER_VERTEX_SHADER = R"(
+#version 330 compatibility
+layout(location = 0) in vec3 a_position;
+layout(location = 2) in vec2 a_texcoord;
+layout(location = 3) in vec4 a_placement;
+layout(location = 4) in vec2 a_yaw;
+layout(location = 5) in vec4 a_color;
+out vec2 v_texcoord;
+out vec4 v_color;
+void main()
+{
+    vec3 p = a_position * a_placement.w;
+    vec3 r = vec3(p.x * a_yaw.x + p.z * a_yaw.y, p.y, p.z * a_yaw.x - p.x * a_yaw.y);
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(a_placement.xyz + r, 1.0);
+    v_texcoord = a_texcoord;
+    v_color = a_color;
+}
+)";
+
+const char* CREEPER_FRAGMENT_SHADER = R"(
+#version 330 compatibility
+in vec2 v_texcoord;
+in vec4 v_color;
+uniform sampler2D u_texture;
+uniform bool u_textured;
+out vec4 frag_color;
+void main()
+{
+    frag_color = u_textured ? v_color * texture(u_texture, v_texcoord) : v_color;
+}
+)";
+
+const void* bufferOffset(size_t offset)
+{
+    return reinterpret_cast<const void*>(offset);
+}
+
+}
+
 zappy::game::entities::CreeperModel::CreeperModel() {
     //std::cout << "🐸 CreeperModel created" << std::endl;
     
@@ -54,6 +97,10 @@ bool zappy::game::entities::CreeperModel::initialize(const std::string& model_pa
         }
     }
     
+    if (!initializeInstancing()) {
+        releaseInstancing();
+    }
+    
     _initialized = true;
     //std::cout << "✅ CreeperModel initialized successfully!" << std::endl;
     
@@ -64,12 +111,68 @@ void zappy::game::entities::CreeperModel::shutdown() {
     if (!_initialized) return;
     
     //std::cout << "🔚 Shutting down CreeperModel..." << std::endl;
+    releaseInstancing();
     _model = nullptr; // ModelLoader manages lifetime
     _texture_loaded = false;
     _team_variations_cache.clear();
     _initialized = false;
 }
 
+bool zappy::game::entities::CreeperModel::initializeInstancing() {
+    // glVertexAttribDivisor et les shaders 330 demandent OpenGL 3.3
+    if (!_model || _model->getVertexBuffer() == 0 || !OpenGLUtils::isVersionAtLeast(3, 3)) {
+        return false;
+    }
+    _program = OpenGLUtils::createShaderProgram(CREEPER_VERTEX_SHADER, CREEPER_FRAGMENT_SHADER);
+    if (_program == 0) {
+        return false;
+    }
+    _textured_location = glGetUniformLocation(_program, "u_textured");
+    
+    const GLsizei stride = zappy::graphics::utils::Model::GPU_VERTEX_STRIDE;
+    glGenVertexArrays(1, &_vertex_array);
+    glBindVertexArray(_vertex_array);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, _model->getVertexBuffer());
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, bufferOffset(0));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, bufferOffset(6 * sizeof(float)));
+    
+    glGenBuffers(1, &_instance_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_buffer);
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(PlayerInstance), bufferOffset(offsetof(PlayerInstance, x)));
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(PlayerInstance), bufferOffset(offsetof(PlayerInstance, cos_yaw)));
+    glVertexAttribDivisor(4, 1);
+    glEnableVertexAttribArray(5);
+    glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PlayerInstance), bufferOffset(offsetof(PlayerInstance, color)));
+    glVertexAttribDivisor(5, 1);
+    
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    _instance_capacity = 0;
+    return glGetError() == GL_NO_ERROR;
+}
+
+void zappy::game::entities::CreeperModel::releaseInstancing() {
+    if (_instance_buffer != 0) {
+        glDeleteBuffers(1, &_instance_buffer);
+    }
+    if (_vertex_array != 0) {
+        glDeleteVertexArrays(1, &_vertex_array);
+    }
+    OpenGLUtils::deleteShaderProgram(_program);
+    _program = 0;
+    _textured_location = -1;
+    _vertex_array = 0;
+    _instance_buffer = 0;
+    _instance_capacity = 0;
+    _instances.clear();
+}
+
 bool zappy::game::entities::CreeperModel::loadCreeperTexture() {
     if (!_texture_manager) return false;
     
@@ -112,6 +215,47 @@ void zappy::game::entities::CreeperModel::renderPlayer(const zappy::game::entiti
     renderCreeperModel(position, rotation, scale, color);
 }
 
+void zappy::game::entities::CreeperModel::renderPlayers(const std::vector<const zappy::game::entities::ZappyPlayer*>& players) {
+    if (!isEnabled() || !isInstancingReady()) return;
+    
+    _instances.clear();
+    for (const ZappyPlayer* entry : players) {
+        const ZappyPlayer& player = *entry;
+        MathUtils::Vector3f position = calculatePlayerPosition(player);
+        float yaw = getPlayerRotation(player) * 3.14159265f / 180.0f;
+        
+        _instances.push_back({position.x, position.y, position.z, calculateScale(player).x,
+                              std::cos(yaw), std::sin(yaw), getPlayerColor(player)});
+    }
+    if (_instances.empty()) return;
+    
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_buffer);
+    if (_instances.size() > _instance_capacity) {
+        _instance_capacity = _instances.size() + _instances.size() / 2 + 16;
+    }
+    // Nouveau stockage à chaque frame : le driver n'attend pas le dessin précédent
+    glBufferData(GL_ARRAY_BUFFER, _instance_capacity * sizeof(PlayerInstance), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, _instances.size() * sizeof(PlayerInstance), _instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    
+    bool textured = isTextureEnabled();
+    if (textured) {
+        OpenGLUtils::enableTexturing();
+        _texture_manager->bindCustomTexture("creeper");
+    } else {
+        OpenGLUtils::disableTexturing();
+    }
+    glUseProgram(_program);
+    glUniform1i(_textured_location, textured ? 1 : 0);
+    glBindVertexArray(_vertex_array);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, _model->getVertexCount(), static_cast<GLsizei>(_instances.size()));
+    glBindVertexArray(0);
+    glUseProgram(0);
+    if (textured) {
+        _texture_manager->unbindTexture();
+    }
+}
+
 void zappy::game::entities::CreeperModel::renderCreeperModel(const MathUtils::Vector3f& position, 
                                      const MathUtils::Vector3f& rotation,
                                      const MathUtils::Vector3f& scale,
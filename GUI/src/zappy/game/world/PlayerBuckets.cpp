@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** PlayerBuckets
+*/
+
+#include "zappy/game/world/PlayerBuckets.hpp"
+
+void zappy::game::world::PlayerBuckets::rebuild(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+    int width, int height)
+{
+    _width = width;
+    _height = height;
+    _entries.clear();
+    _entries.reserve(players.size());
+    // La map est parcourue par id croissant, le tri stable garde cet ordre dans chaque tile
+    for (const auto& player_pair : players) {
+        const zappy::game::entities::ZappyPlayer& player = player_pair.second;
+        if (player.x >= 0 && player.y >= 0 && player.x < width && player.y < height) {
+            _entries.push_back({player.y * width + player.x, player.id});
+        }
+    }
+    std::stable_sort(_entries.begin(), _entries.end(),
+        [](const Entry& a, const Entry& b) { return a.tile < b.tile; });
+}
@@ -8,6 +8,16 @@
 #include "zappy/game/world/SharedGameState.hpp"
 #include <iostream>
 #include <sstream>
+#include <algorithm>
+
+zappy::game::world::SharedGameState::SharedGameState()
+{
+    // Les snapshots sont alloués une fois, publishSnapshot les réutilise
+    for (SnapshotSlot& slot : _slots) {
+        slot.snapshot = std::make_shared<GameSnapshot>();
+    }
+    _front = _slots[_front_slot].snapshot;
+}
 
 void zappy::game::world::SharedGameState::setMapSize(int width, int height) {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -24,50 +34,73 @@ void zappy::game::world::SharedGameState::setMapSize(int width, int height) {
             _world_map[y][x] = ZappyTile(x, y);
         }
     }
+    _dirty_marks.assign(static_cast<size_t>(width) * height, 0);
+    markAllTilesDirty();
     
     //std::cout << "[SharedGameState] Map size set to " << width << "x" << height << std::endl;
 }
 
-void zappy::game::world::SharedGameState::updateTile(int x, int y, const std::vector<int>& resources) {
-    std::lock_guard<std::mutex> lock(_mutex);
+bool zappy::game::world::SharedGameState::storeTile(const ZappyTile& resources) {
+    int x = resources.x;
+    int y = resources.y;
     
     if (x < 0 || x >= _map_width || y < 0 || y >= _map_height) {
         std::cerr << "[SharedGameState] Invalid tile coordinates: (" << x << ", " << y << ")" << std::endl;
-        return;
+        return false;
     }
     
-    if (resources.size() != 7) {
-        std::cerr << "[SharedGameState] Invalid resource count: " << resources.size() << std::endl;
+    ZappyTile& tile = _world_map[y][x];
+    bool changed = tile.food != resources.food || tile.linemate != resources.linemate
+        || tile.deraumere != resources.deraumere || tile.sibur != resources.sibur
+        || tile.mendiane != resources.mendiane || tile.phiras != resources.phiras
+        || tile.thystame != resources.thystame;
+    if (changed) {
+        tile = resources;
+        markTileDirty(x, y);
+    }
+    return changed;
+}
+
+void zappy::game::world::SharedGameState::updateTiles(const std::vector<ZappyTile>& tiles) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    int min_x = _map_width;
+    int min_y = _map_height;
+    int max_x = -1;
+    int max_y = -1;
+    
+    for (const ZappyTile& tile : tiles) {
+        if (storeTile(tile)) {
+            min_x = std::min(min_x, tile.x);
+            min_y = std::min(min_y, tile.y);
+            max_x = std::max(max_x, tile.x);
+            max_y = std::max(max_y, tile.y);
+        }
+    }
+    if (max_x < 0) {
         return;
     }
     
-    ZappyTile& tile = _world_map[y][x];
-    tile.food = resources[0];
-    tile.linemate = resources[1];
-    tile.deraumere = resources[2];
-    tile.sibur = resources[3];
-    tile.mendiane = resources[4];
-    tile.phiras = resources[5];
-    tile.thystame = resources[6];
-    
-    // Créer un événement de changement de ressource
+    // Un seul événement pour tout le lot, le détail par tile suit le snapshot
     GameEvent event;
-    event.type = GameEvent::RESOURCE_CHANGED;
-    event.x = x;
-    event.y = y;
-    _events.push(event);
+    event.type = GameEvent::REGION_CHANGED;
+    event.x = min_x;
+    event.y = min_y;
+    event.width = max_x - min_x + 1;
+    event.height = max_y - min_y + 1;
+    addEvent(event);
 }
 
 void zappy::game::world::SharedGameState::updateAllTiles(const std::vector<std::vector<ZappyTile>>& tiles) {
     std::lock_guard<std::mutex> lock(_mutex);
     _world_map = tiles;
+    markAllTilesDirty();
     
     // Créer un événement global de mise à jour
     GameEvent event;
     event.type = GameEvent::RESOURCE_CHANGED;
     event.x = -1; // Indique une mise à jour globale
     event.y = -1;
-    _events.push(event);
+    addEvent(event);
 }
 
 void zappy::game::world::SharedGameState::addPlayer(int id, int x, int y, int orientation, int level, const std::string& team) {
@@ -89,6 +122,7 @@ void zappy::game::world::SharedGameState::addPlayer(int id, int x, int y, int or
     else player.color = sf::Color::White;
     
     _players[id] = player;
+    _players_dirty = true;
     
     //std::cout << "[SharedGameState] Player " << id << " added at (" << x << ", " << y 
 //<< ") team: " << team << std::endl;
@@ -106,6 +140,7 @@ void zappy::game::world::SharedGameState::updatePlayerPosition(int id, int x, in
     it->second.x = x;
     it->second.y = y;
     it->second.orientation = orientation;
+    _players_dirty = true;
     
     // Créer un événement de mouvement
     GameEvent event;
@@ -113,7 +148,7 @@ void zappy::game::world::SharedGameState::updatePlayerPosition(int id, int x, in
     event.player_id = id;
     event.x = x;
     event.y = y;
-    _events.push(event);
+    addEvent(event);
 }
 
 void zappy::game::world::SharedGameState::updatePlayerLevel(int id, int level) {
@@ -126,13 +161,14 @@ void zappy::game::world::SharedGameState::updatePlayerLevel(int id, int level) {
     }
     
     it->second.level = level;
+    _players_dirty = true;
     
     // Créer un événement de level up
     GameEvent event;
     event.type = GameEvent::PLAYER_LEVELED;
     event.player_id = id;
-    event.data["level"] = level;
-    _events.push(event);
+    event.level = level;
+    addEvent(event);
 }
 
 void zappy::game::world::SharedGameState::updatePlayerInventory(int id, int x, int y, const std::vector<int>& inventory) {
@@ -147,6 +183,7 @@ void zappy::game::world::SharedGameState::updatePlayerInventory(int id, int x, i
     // Mettre à jour la position aussi (protocole pin)
     it->second.x = x;
     it->second.y = y;
+    _players_dirty = true;
     
     // Mettre à jour l'inventaire du joueur
     // Format: q0 q1 q2 q3 q4 q5 q6 (food, linemate, deraumere, sibur, mendiane, phiras, thystame)
@@ -180,12 +217,13 @@ void zappy::game::world::SharedGameState::removePlayer(int id) {
     }
     
     _players.erase(it);
+    _players_dirty = true;
     
     // Créer un événement de mort
     GameEvent event;
     event.type = GameEvent::PLAYER_DIED;
     event.player_id = id;
-    _events.push(event);
+    addEvent(event);
     
     //std::cout << "[SharedGameState] Player " << id << " removed" << std::endl;
 }
@@ -201,37 +239,206 @@ void zappy::game::world::SharedGameState::setTeamNames(const std::vector<std::st
     std::cout << std::endl;
 }
 
-void zappy::game::world::SharedGameState::addEvent(const GameEvent& event) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _events.push(event);
+bool zappy::game::world::SharedGameState::addEvent(const GameEvent& event) {
+    // Ring pleine : le rendu ne suit pas, l'événement est perdu
+    if (!_events.tryPush(event)) {
+        _event_texts.cancel(event.text);
+        return false;
+    }
+    return true;
 }
 
-std::vector<zappy::game::world::GameEvent> zappy::game::world::SharedGameState::getAndClearEvents() {
-    std::lock_guard<std::mutex> lock(_mutex);
-    
-    std::vector<GameEvent> events;
-    while (!_events.empty()) {
-        events.push_back(_events.front());
-        _events.pop();
+zappy::game::world::StringTable::Id zappy::game::world::SharedGameState::internEventString(std::string_view tag) {
+    return _event_strings.intern(tag);
+}
+
+zappy::game::world::TextId zappy::game::world::SharedGameState::copyEventText(std::string_view text) {
+    // Tous les slots encore lus par le rendu : l'événement part sans texte
+    return _event_texts.acquire(text);
+}
+
+std::size_t zappy::game::world::SharedGameState::drainEvents(std::vector<GameEvent>& events) {
+    GameEvent event;
+
+    events.clear();
+    while (_events.tryPop(event)) {
+        events.push_back(event);
     }
-    return events;
+    return events.size();
 }
 
-void zappy::game::world::SharedGameState::addPendingCommand(const NetworkCommand& command) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _pending_commands.push(command);
-    std::cout << "pending command : " << command.command.c_str() << std::endl;
+bool zappy::game::world::SharedGameState::addPendingCommand(std::string_view command, int priority) {
+    NetworkCommand pending;
+    pending.command = _command_texts.acquire(command);
+    pending.priority = priority;
+
+    if (pending.command == NO_TEXT || !_pending_commands.tryPush(pending)) {
+        _command_texts.cancel(pending.command);
+        std::cerr << "[SharedGameState] Command queue full, dropped: " << command << std::endl;
+        return false;
+    }
+    std::cout << "pending command : " << command << std::endl;
+    return true;
 }
 
-std::vector<zappy::game::world::NetworkCommand> zappy::game::world::SharedGameState::getAndClearPendingCommands() {
-    std::lock_guard<std::mutex> lock(_mutex);
+std::size_t zappy::game::world::SharedGameState::drainPendingCommands(std::vector<NetworkCommand>& commands) {
+    NetworkCommand command;
+
+    commands.clear();
+    while (_pending_commands.tryPop(command)) {
+        commands.push_back(command);
+    }
+    return commands.size();
+}
+
+void zappy::game::world::SharedGameState::markTileDirty(int x, int y) {
+    size_t index = static_cast<size_t>(y) * _map_width + x;
+
+    if (_all_tiles_dirty || index >= _dirty_marks.size() || _dirty_marks[index]) {
+        return;
+    }
+    _dirty_marks[index] = 1;
+    _dirty_tiles.push_back(static_cast<int>(index));
+    // Past half the map a full copy is cheaper than the tile list
+    if (_dirty_tiles.size() > _dirty_marks.size() / 2) {
+        markAllTilesDirty();
+    }
+}
+
+void zappy::game::world::SharedGameState::markAllTilesDirty() {
+    for (int index : _dirty_tiles) {
+        _dirty_marks[index] = 0;
+    }
+    _dirty_tiles.clear();
+    _all_tiles_dirty = true;
+}
+
+int zappy::game::world::SharedGameState::findFreeSlot() const {
+    // Le pool et _front tiennent le front, le renderer au plus un autre slot
+    for (int i = 0; i < SNAPSHOT_SLOTS; ++i) {
+        if (i != _front_slot && _slots[i].snapshot.use_count() == 1) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void zappy::game::world::SharedGameState::refreshSlot(SnapshotSlot& slot) {
+    GameSnapshot& snapshot = *slot.snapshot;
+    bool resized = snapshot.map_width != _map_width || snapshot.map_height != _map_height;
+    bool players = slot.missed_players || _players_dirty;
+
+    if (slot.missed_all_tiles || _all_tiles_dirty || resized) {
+        snapshot.map_width = _map_width;
+        snapshot.map_height = _map_height;
+        snapshot.world_map = _world_map;
+    } else {
+        for (const std::vector<int>* tiles : {&slot.missed_tiles, &_dirty_tiles}) {
+            for (int index : *tiles) {
+                snapshot.world_map[index / _map_width][index % _map_width] =
+                    _world_map[index / _map_width][index % _map_width];
+            }
+        }
+    }
+    if (players) {
+        snapshot.players = _players;
+    }
+    if (players || resized) {
+        snapshot.player_buckets.rebuild(snapshot.players, _map_width, _map_height);
+    }
+    for (int index : slot.missed_tiles) {
+        slot.missed_marks[index] = 0;
+    }
+    slot.missed_tiles.clear();
+    slot.missed_all_tiles = false;
+    slot.missed_players = false;
+}
+
+void zappy::game::world::SharedGameState::recordMissed(SnapshotSlot& slot) {
+    size_t tiles = _dirty_marks.size();
+
+    slot.missed_players = slot.missed_players || _players_dirty;
+    if (slot.missed_marks.size() != tiles) {
+        slot.missed_marks.assign(tiles, 0);
+        slot.missed_tiles.clear();
+        slot.missed_all_tiles = true;
+    }
+    if (slot.missed_all_tiles || _all_tiles_dirty) {
+        slot.missed_all_tiles = true;
+        return;
+    }
+    for (int index : _dirty_tiles) {
+        if (!slot.missed_marks[index]) {
+            slot.missed_marks[index] = 1;
+            slot.missed_tiles.push_back(index);
+        }
+    }
+    // Past half the map a full copy is cheaper than the tile list
+    if (slot.missed_tiles.size() > tiles / 2) {
+        for (int index : slot.missed_tiles) {
+            slot.missed_marks[index] = 0;
+        }
+        slot.missed_tiles.clear();
+        slot.missed_all_tiles = true;
+    }
+}
+
+void zappy::game::world::SharedGameState::accumulateTileChanges() {
+    std::uint64_t published = _generation.load();
+    bool caught_up = _rendered_generation.load() >= published;
+    size_t words = (static_cast<size_t>(_map_width) * _map_height + 63) / 64;
     
-    std::vector<NetworkCommand> commands;
-    while (!_pending_commands.empty()) {
-        commands.push_back(_pending_commands.front());
-        _pending_commands.pop();
+    // Once the renderer holds the last published map, older changes are applied
+    if (caught_up || _tile_changes.bits.size() != words) {
+        _tile_changes.all_tiles = !caught_up;
+        _tile_changes.since_generation = published;
+        _tile_changes.bits.assign(words, 0);
+    }
+    if (_all_tiles_dirty) {
+        _tile_changes.all_tiles = true;
+        return;
+    }
+    for (int index : _dirty_tiles) {
+        _tile_changes.mark(static_cast<size_t>(index));
+    }
+}
+
+void zappy::game::world::SharedGameState::publishSnapshot() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_all_tiles_dirty && _dirty_tiles.empty() && !_players_dirty) {
+        return;
+    }
+    // Never write into a snapshot the renderer holds. When it holds every
+    // other slot, the changes stay dirty and go out with the next publish.
+    int free_slot = findFreeSlot();
+    if (free_slot < 0) {
+        return;
     }
-    return commands;
+    SnapshotSlot& slot = _slots[free_slot];
+    refreshSlot(slot);
+    accumulateTileChanges();
+    slot.snapshot->tile_changes = _tile_changes;
+    slot.snapshot->generation = ++_generation;
+    std::atomic_exchange(&_front, slot.snapshot);
+    _front_slot = free_slot;
+
+    // The other slots missed exactly what was just published
+    for (int i = 0; i < SNAPSHOT_SLOTS; ++i) {
+        if (i != free_slot) {
+            recordMissed(_slots[i]);
+        }
+    }
+    for (int index : _dirty_tiles) {
+        _dirty_marks[index] = 0;
+    }
+    _dirty_tiles.clear();
+    _all_tiles_dirty = false;
+    _players_dirty = false;
+}
+
+std::shared_ptr<const zappy::game::world::GameSnapshot> zappy::game::world::SharedGameState::getSnapshot() const {
+    return std::atomic_load(&_front);
 }
 
 std::vector<std::vector<zappy::game::world::ZappyTile>> zappy::game::world::SharedGameState::getWorldMap() const {
@@ -348,6 +555,7 @@ void zappy::game::world::SharedGameState::updatePlayerResourceDelta(int player_i
             std::cerr << "[SharedGameState] Invalid resource type: " << resource_type << std::endl;
             return;
     }
+    _players_dirty = true;
     
     //std::cout << "[SharedGameState] Player " << player_id << " resource " << resource_type 
 //<< " changed by " << delta << std::endl;
@@ -391,6 +599,7 @@ void zappy::game::world::SharedGameState::updateTileResourceDelta(int x, int y,
             std::cerr << "[SharedGameState] Invalid resource type: " << resource_type << std::endl;
             return;
     }
+    markTileDirty(x, y);
     
     //std::cout << "[SharedGameState] Tile (" << x << ", " << y << ") resource " << resource_type 
 //<< " changed by " << delta << std::endl;
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** StringTable
+*/
+
+#include "zappy/game/world/StringTable.hpp"
+
+zappy::game::world::StringTable::StringTable()
+{
+    // L'id 0 est réservé à la chaîne vide
+    _blocks[0] = std::make_unique<std::string[]>(BLOCK_SIZE);
+    _count = 1;
+}
+
+zappy::game::world::StringTable::Id zappy::game::world::StringTable::intern(std::string_view text)
+{
+    if (text.empty()) {
+        return EMPTY;
+    }
+    auto it = _ids.find(text);
+    if (it != _ids.end()) {
+        return it->second;
+    }
+    if (_count >= BLOCK_SIZE * MAX_BLOCKS) {
+        return EMPTY;
+    }
+
+    std::size_t block = _count / BLOCK_SIZE;
+    if (!_blocks[block]) {
+        _blocks[block] = std::make_unique<std::string[]>(BLOCK_SIZE);
+    }
+    // Published to the consumer by the release store of the ring push
+    std::string& stored = _blocks[block][_count % BLOCK_SIZE];
+    stored.assign(text.data(), text.size());
+    Id id = static_cast<Id>(_count++);
+    // The stored string never moves, its view stays valid as a key
+    _ids.emplace(std::string_view(stored), id);
+    return id;
+}
+
+const std::string& zappy::game::world::StringTable::get(Id id) const
+{
+    if (id >= BLOCK_SIZE * MAX_BLOCKS) {
+        return _blocks[0][EMPTY];
+    }
+    return _blocks[id / BLOCK_SIZE][id % BLOCK_SIZE];
+}
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Chunk grid
+*/
+
+#include "zappy/graphics/renderers/ChunkGrid.hpp"
+#include <algorithm>
+
+void zappy::graphics::renderers::ChunkGrid::resize(int width, int height)
+{
+    _width = std::max(width, 0);
+    _height = std::max(height, 0);
+    _chunks_x = (_width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    int chunks_y = (_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    size_t tiles = static_cast<size_t>(_width) * _height;
+
+    _tile_slots.assign(tiles, 0);
+    _slot_tiles.assign(tiles, 0);
+    _chunk_first.assign(1, 0);
+    int slot = 0;
+    for (int chunk = 0; chunk < _chunks_x * chunks_y; ++chunk) {
+        int x0, y0, x1, y1;
+        chunkTiles(chunk, x0, y0, x1, y1);
+        for (int y = y0; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                _tile_slots[static_cast<size_t>(y) * _width + x] = slot;
+                _slot_tiles[slot++] = y * _width + x;
+            }
+        }
+        _chunk_first.push_back(slot);
+    }
+    updateVisibility(nullptr, Bounds(), LodThresholds());
+}
+
+int zappy::graphics::renderers::ChunkGrid::chunkOf(int x, int y) const
+{
+    // Les joueurs hors carte vont dans le chunk du bord le plus proche
+    x = std::max(0, std::min(x, _width - 1));
+    y = std::max(0, std::min(y, _height - 1));
+    return (y / CHUNK_SIZE) * _chunks_x + x / CHUNK_SIZE;
+}
+
+void zappy::graphics::renderers::ChunkGrid::chunkTiles(int chunk, int& x0, int& y0, int& x1, int& y1) const
+{
+    x0 = (chunk % _chunks_x) * CHUNK_SIZE;
+    y0 = (chunk / _chunks_x) * CHUNK_SIZE;
+    x1 = std::min(x0 + CHUNK_SIZE, _width);
+    y1 = std::min(y0 + CHUNK_SIZE, _height);
+}
+
+void zappy::graphics::renderers::ChunkGrid::appendRange(std::vector<SlotRange>& ranges, int first, int end)
+{
+    if (!ranges.empty() && ranges.back().end == first) {
+        ranges.back().end = end;
+    } else {
+        ranges.push_back({first, end});
+    }
+}
+
+zappy::graphics::renderers::ChunkGrid::Detail zappy::graphics::renderers::ChunkGrid::chunkDetail(
+    const zappy::graphics::utils::Frustum& frustum, const MathUtils::Vector3f& min,
+    const MathUtils::Vector3f& max, const LodThresholds& lod) const
+{
+    const MathUtils::Vector3f& eye = frustum.getEye();
+    MathUtils::Vector3f nearest(std::max(min.x, std::min(eye.x, max.x)),
+                                std::max(min.y, std::min(eye.y, max.y)),
+                                std::max(min.z, std::min(eye.z, max.z)));
+    float tile_pixels = frustum.pixelsPerUnit((nearest - eye).length());
+
+    if (tile_pixels < lod.aggregate_below) {
+        return Detail::AGGREGATED;
+    }
+    return (tile_pixels < lod.points_below) ? Detail::POINTS : Detail::FULL;
+}
+
+void zappy::graphics::renderers::ChunkGrid::updateVisibility(const zappy::graphics::utils::Frustum* frustum,
+    const Bounds& bounds, const LodThresholds& lod)
+{
+    int chunks = getChunkCount();
+
+    _culling = frustum && frustum->isValid();
+    _visible.assign(chunks, 1);
+    _detail.assign(chunks, Detail::FULL);
+    _visible_chunks.clear();
+    _visible_ranges.clear();
+    _detail_ranges.clear();
+    _aggregated_chunks.clear();
+    _visible_tiles = 0;
+    _detail_tiles = 0;
+    for (int chunk = 0; chunk < chunks; ++chunk) {
+        int first = _chunk_first[chunk];
+        int end = _chunk_first[chunk + 1];
+        if (_culling) {
+            int x0, y0, x1, y1;
+            chunkTiles(chunk, x0, y0, x1, y1);
+            MathUtils::Vector3f min(x0 - bounds.margin, bounds.min_y, y0 - bounds.margin);
+            MathUtils::Vector3f max(x1 - 1 + bounds.margin, bounds.max_y, y1 - 1 + bounds.margin);
+            _visible[chunk] = frustum->intersectsBox(min, max) ? 1 : 0;
+            if (_visible[chunk] && lod.enabled) {
+                _detail[chunk] = chunkDetail(*frustum, min, max, lod);
+            }
+        }
+        if (!_visible[chunk]) {
+            continue;
+        }
+        _visible_chunks.push_back(chunk);
+        appendRange(_visible_ranges, first, end);
+        _visible_tiles += end - first;
+        if (_detail[chunk] == Detail::AGGREGATED) {
+            _aggregated_chunks.push_back(chunk);
+        } else {
+            appendRange(_detail_ranges, first, end);
+            _detail_tiles += end - first;
+        }
+    }
+}
@@ -0,0 +1,203 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Aggregated far chunks
+*/
+
+#include "zappy/graphics/renderers/ChunkLodMesh.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+// Les côtés sont assombris comme la terre sous l'herbe
+const sf::Color TOP_SHADE(255, 255, 255);
+const sf::Color SIDE_SHADE(150, 120, 90);
+
+const void* bufferOffset(size_t offset)
+{
+    return reinterpret_cast<const void*>(offset);
+}
+
+}
+
+zappy::graphics::renderers::ChunkLodMesh::~ChunkLodMesh()
+{
+    release();
+}
+
+bool zappy::graphics::renderers::ChunkLodMesh::matches(int width, int height, float tile_size, float tile_height) const
+{
+    return isBuilt() && _width == width && _height == height &&
+           _tile_size == tile_size && _tile_height == tile_height;
+}
+
+void zappy::graphics::renderers::ChunkLodMesh::appendChunk(int chunk, std::vector<Vertex>& vertices) const
+{
+    int x0, y0, x1, y1;
+    _layout.chunkTiles(chunk, x0, y0, x1, y1);
+    float h = _tile_size / 2.0f;
+    float left = x0 - h;
+    float right = x1 - 1 + h;
+    float back = y0 - h;
+    float front = y1 - 1 + h;
+    float top = _tile_height;
+    float u0 = static_cast<float>(x0) / _width;
+    float u1 = static_cast<float>(x1) / _width;
+    float v0 = static_cast<float>(y0) / _height;
+    float v1 = static_cast<float>(y1) / _height;
+
+    // Coins du dessus, puis du bas ; les côtés reprennent la couleur du bord
+    const Vertex corners[8] = {
+        {left, top, back, u0, v0, TOP_SHADE}, {right, top, back, u1, v0, TOP_SHADE},
+        {right, top, front, u1, v1, TOP_SHADE}, {left, top, front, u0, v1, TOP_SHADE},
+        {left, 0.0f, back, u0, v0, SIDE_SHADE}, {right, 0.0f, back, u1, v0, SIDE_SHADE},
+        {right, 0.0f, front, u1, v1, SIDE_SHADE}, {left, 0.0f, front, u0, v1, SIDE_SHADE}
+    };
+    const int faces[5][4] = {
+        {0, 1, 2, 3}, {7, 6, 2, 3}, {5, 4, 0, 1}, {4, 7, 3, 0}, {6, 5, 1, 2}
+    };
+    for (const auto& face : faces) {
+        for (int corner : {face[0], face[1], face[2], face[0], face[2], face[3]}) {
+            Vertex vertex = corners[corner];
+            if (face[0] != 0) {
+                vertex.shade = SIDE_SHADE;
+            }
+            vertices.push_back(vertex);
+        }
+    }
+}
+
+bool zappy::graphics::renderers::ChunkLodMesh::build(int width, int height, float tile_size, float tile_height)
+{
+    GLint max_texture = 0;
+
+    release();
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture);
+    if (width <= 0 || height <= 0 || width > max_texture || height > max_texture) {
+        return false;
+    }
+    _width = width;
+    _height = height;
+    _tile_size = tile_size;
+    _tile_height = tile_height;
+    _layout.resize(width, height);
+
+    std::vector<Vertex> vertices;
+    vertices.reserve(static_cast<size_t>(_layout.getChunkCount()) * VERTICES_PER_CHUNK);
+    for (int chunk = 0; chunk < _layout.getChunkCount(); ++chunk) {
+        appendChunk(chunk, vertices);
+    }
+    glGenBuffers(1, &_vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Mipmaps : de loin, plusieurs tiles tombent dans un pixel
+    _texels.assign(static_cast<size_t>(width) * height, sf::Color::White);
+    glGenTextures(1, &_texture);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, _texels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+    _dirty_first_row = 0;
+    _dirty_end_row = 0;
+
+    if (glGetError() != GL_NO_ERROR) {
+        release();
+        return false;
+    }
+    return true;
+}
+
+void zappy::graphics::renderers::ChunkLodMesh::release()
+{
+    if (_vertex_buffer != 0) {
+        glDeleteBuffers(1, &_vertex_buffer);
+    }
+    if (_texture != 0) {
+        glDeleteTextures(1, &_texture);
+    }
+    _vertex_buffer = 0;
+    _texture = 0;
+    _width = 0;
+    _height = 0;
+    _texels.clear();
+    _dirty_first_row = 0;
+    _dirty_end_row = 0;
+}
+
+void zappy::graphics::renderers::ChunkLodMesh::setTileColor(int x, int y, const sf::Color& color)
+{
+    if (x < 0 || x >= _width || y < 0 || y >= _height) {
+        return;
+    }
+    sf::Color& texel = _texels[static_cast<size_t>(y) * _width + x];
+
+    if (texel == color) {
+        return;
+    }
+    texel = color;
+    if (_dirty_first_row == _dirty_end_row) {
+        _dirty_first_row = y;
+        _dirty_end_row = y + 1;
+    } else {
+        _dirty_first_row = std::min(_dirty_first_row, y);
+        _dirty_end_row = std::max(_dirty_end_row, y + 1);
+    }
+}
+
+void zappy::graphics::renderers::ChunkLodMesh::uploadDirtyTexels()
+{
+    if (!isBuilt() || _dirty_first_row == _dirty_end_row) {
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, _dirty_first_row, _width, _dirty_end_row - _dirty_first_row,
+                    GL_RGBA, GL_UNSIGNED_BYTE, &_texels[static_cast<size_t>(_dirty_first_row) * _width]);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    _dirty_first_row = 0;
+    _dirty_end_row = 0;
+}
+
+void zappy::graphics::renderers::ChunkLodMesh::draw(const std::vector<int>& chunks) const
+{
+    if (!isBuilt() || chunks.empty()) {
+        return;
+    }
+    // Chunks consécutifs fusionnés, un seul appel pour toute la liste
+    _firsts.clear();
+    _counts.clear();
+    for (int chunk : chunks) {
+        GLint first = chunk * VERTICES_PER_CHUNK;
+        if (!_firsts.empty() && _firsts.back() + _counts.back() == first) {
+            _counts.back() += VERTICES_PER_CHUNK;
+        } else {
+            _firsts.push_back(first);
+            _counts.push_back(VERTICES_PER_CHUNK);
+        }
+    }
+
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, x)));
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, u)));
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), bufferOffset(offsetof(Vertex, shade)));
+
+    glMultiDrawArrays(GL_TRIANGLES, _firsts.data(), _counts.data(), static_cast<GLsizei>(_firsts.size()));
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
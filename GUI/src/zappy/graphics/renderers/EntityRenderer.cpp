@@ -80,14 +80,89 @@ void zappy::graphics::renderers::EntityRenderer::renderDirectionIndicator(const
         _config.indicator_color);
 }
 
-void zappy::graphics::renderers::EntityRenderer::renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players)
+void zappy::graphics::renderers::EntityRenderer::shutdown()
 {
+    // Le CreeperModel libère ses buffers tant que le contexte existe
+    delete _creeper_model;
+    _creeper_model = nullptr;
+    _initialized = false;
+}
+
+void zappy::graphics::renderers::EntityRenderer::renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+    int skip_player_id)
+{
+    if (!_initialized) return;
+    
+    collectVisiblePlayers(players, skip_player_id);
+    renderPlayerPoints(_far_players);
+    if (_creeper_model && _creeper_model->isEnabled() && _creeper_model->isInstancingReady()) {
+        _creeper_model->renderPlayers(_visible_players);
+        _players_rendered += _visible_players.size();
+        return;
+    }
+    for (const auto* player : _visible_players) {
+        renderPlayer(*player);
+        renderDirectionIndicator(*player);
+    }
+}
+
+void zappy::graphics::renderers::EntityRenderer::collectVisiblePlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+    int skip_player_id)
+{
+    _visible_players.clear();
+    _far_players.clear();
+    if (!_chunks || !_chunks->isCulling() || _chunks->getChunkCount() == 0) {
+        for (const auto& pair : players) {
+            if (pair.first != skip_player_id) {
+                _visible_players.push_back(&pair.second);
+            }
+        }
+        return;
+    }
+    
+    // Rangement par chunk, puis seuls les chunks visibles sont parcourus
+    _player_bins.resize(_chunks->getChunkCount());
+    for (auto& bin : _player_bins) {
+        bin.clear();
+    }
     for (const auto& pair : players) {
-        renderPlayer(pair.second);
-        renderDirectionIndicator(pair.second);
+        if (pair.first != skip_player_id) {
+            _player_bins[_chunks->chunkOf(pair.second.x, pair.second.y)].push_back(&pair.second);
+        }
+    }
+    for (int chunk : _chunks->getVisibleChunks()) {
+        auto& target = (_chunks->getChunkDetail(chunk) == ChunkGrid::Detail::FULL) ? _visible_players : _far_players;
+        target.insert(target.end(), _player_bins[chunk].begin(), _player_bins[chunk].end());
     }
 }
 
+void zappy::graphics::renderers::EntityRenderer::renderPlayerPoints(const std::vector<const zappy::game::entities::ZappyPlayer*>& players)
+{
+    if (players.empty()) {
+        return;
+    }
+    // Quelques pixels à l'écran : un point de la couleur d'équipe suffit
+    _points.clear();
+    for (const auto* player : players) {
+        MathUtils::Vector3f pos = getPlayerPosition(*player);
+        sf::Color color = player->color;
+        applyBrightness(color);
+        _points.push_back({pos.x, pos.y + _config.player_height * 0.5f, pos.z, color});
+    }
+    
+    OpenGLUtils::disableTexturing();
+    glPointSize(_config.point_size);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(PointVertex), &_points[0].x);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(PointVertex), &_points[0].color);
+    glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(_points.size()));
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glPointSize(1.0f);
+    _players_rendered += _points.size();
+}
+
 void zappy::graphics::renderers::EntityRenderer::renderPlayersRange(const std::map<int, zappy::game::entities::ZappyPlayer>& players, 
                                        int start_id, int end_id)
 {
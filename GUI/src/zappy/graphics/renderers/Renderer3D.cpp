@@ -7,6 +7,7 @@
 
 #include "zappy/graphics/renderers/Renderer3D.hpp"
 #include "zappy/graphics/utils/OpenGLUtils.hpp"
+#include "zappy/graphics/utils/ModelLoader.hpp"
 #include <iostream>
 
 zappy::graphics::renderers::Renderer3D::Renderer3D()
@@ -45,6 +46,15 @@ void zappy::graphics::renderers::Renderer3D::shutdown()
     if (!_initialized) return;
     
     //std::cout << "🔚 Shutting down Renderer3D..." << std::endl;
+    // GPU buffers must go while the context is still alive
+    _terrain_renderer.shutdown();
+    _entity_renderer.shutdown();
+    zappy::graphics::utils::ModelLoader::unloadAllModels();
+    if (_timer_queries[0] != 0) {
+        glDeleteQueries(2, _timer_queries);
+        _timer_queries[0] = 0;
+        _timer_queries[1] = 0;
+    }
     _initialized = false;
 }
 
@@ -79,6 +89,15 @@ void zappy::graphics::renderers::Renderer3D::setupSystems()
     // Initialize entity renderer avec TextureManager pour les Creepers
     _entity_renderer.initialize(&_texture_manager);
     
+    // Les deux renderers lisent la visibilité calculée par updateVisibility
+    _terrain_renderer.setChunkGrid(&_chunks);
+    _entity_renderer.setChunkGrid(&_chunks);
+    
+    // GL_TIME_ELAPSED est dans le coeur depuis OpenGL 3.3
+    if (OpenGLUtils::isVersionAtLeast(3, 3)) {
+        glGenQueries(2, _timer_queries);
+    }
+    
     //std::cout << "✅ All rendering systems initialized!" << std::endl;
 }
 
@@ -127,18 +146,74 @@ void zappy::graphics::renderers::Renderer3D::renderPlayer(const zappy::game::ent
     _entity_renderer.renderPlayer(player);
 }
 
-void zappy::graphics::renderers::Renderer3D::renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map)
+void zappy::graphics::renderers::Renderer3D::renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    std::uint64_t generation, const zappy::game::world::TileChanges* changes)
 {
     if (!_initialized) return;
     
-    _terrain_renderer.renderTileMap(world_map);
+    _terrain_renderer.renderTileMap(world_map, generation, changes);
 }
 
-void zappy::graphics::renderers::Renderer3D::renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players)
+void zappy::graphics::renderers::Renderer3D::renderPlayers(const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+    int skip_player_id)
 {
     if (!_initialized) return;
     
-    _entity_renderer.renderPlayers(players);
+    _entity_renderer.renderPlayers(players, skip_player_id);
+}
+
+void zappy::graphics::renderers::Renderer3D::updateVisibility(const zappy::graphics::utils::Frustum& frustum,
+    int map_width, int map_height)
+{
+    ChunkGrid::Bounds bounds;
+    ChunkGrid::LodThresholds lod;
+    bool use_frustum = _config.frustum_culling || _config.level_of_detail;
+    
+    if (!_chunks.matches(map_width, map_height)) {
+        _chunks.resize(map_width, map_height);
+    }
+    // Les creepers et les piles de ressources dépassent de leur tile
+    bounds.margin = 1.0f;
+    bounds.min_y = 0.0f;
+    bounds.max_y = 3.0f;
+    lod.enabled = _config.level_of_detail;
+    lod.points_below = _config.lod_points_below;
+    lod.aggregate_below = _config.lod_aggregate_below;
+    _chunks.updateVisibility(use_frustum ? &frustum : nullptr, bounds, lod);
+}
+
+void zappy::graphics::renderers::Renderer3D::beginSceneTimer()
+{
+    _scene_clock.restart();
+    if (_timer_queries[0] != 0) {
+        glBeginQuery(GL_TIME_ELAPSED, _timer_queries[_timer_index]);
+    }
+}
+
+void zappy::graphics::renderers::Renderer3D::endSceneTimer()
+{
+    _scene_cpu_ms = _scene_clock.getElapsedTime().asMicroseconds() / 1000.0f;
+    if (_timer_queries[0] == 0) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    _timer_pending[_timer_index] = true;
+    
+    // La requête de la frame précédente, seulement si le GPU l'a déjà terminée
+    int previous = 1 - _timer_index;
+    GLint available = GL_FALSE;
+    if (_timer_pending[previous]) {
+        glGetQueryObjectiv(_timer_queries[previous], GL_QUERY_RESULT_AVAILABLE, &available);
+    }
+    if (available == GL_TRUE) {
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(_timer_queries[previous], GL_QUERY_RESULT, &elapsed_ns);
+        _scene_gpu_ms = static_cast<float>(elapsed_ns) / 1000000.0f;
+        _timer_pending[previous] = false;
+    }
+    if (!_timer_pending[previous]) {
+        _timer_index = previous;
+    }
 }
 
 void zappy::graphics::renderers::Renderer3D::renderText(const sf::Font& font, const std::string& text, 
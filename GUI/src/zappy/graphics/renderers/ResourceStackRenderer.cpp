@@ -0,0 +1,369 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Instanced resource stacks
+*/
+
+#include "zappy/graphics/renderers/ResourceStackRenderer.hpp"
+#include "zappy/graphics/utils/OpenGLUtils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace {
+
+constexpr int CUBE_VERTICES = 36;
+
+// Cube unité posé sur y = 0, mis à l'échelle et déplacé par instance
+const char* STACK_VERTEX_SHADER = R"(
+#version 330 compatibility
+layout(location = 0) in vec3 a_position;
+layout(location = 2) in vec3 a_offset;
+layout(location = 3) in vec4 a_color;
+uniform vec2 u_size;
+out vec4 v_color;
+void main()
+{
+    vec3 world = a_offset + a_position * vec3(u_size.x, u_size.y, u_size.x);
+    gl_Position = gl_ModelViewProjectionMatrix * vec4(world, 1.0);
+    v_color = a_color;
+}
+)";
+
+const char* STACK_FRAGMENT_SHADER = R"(
+#version 330 compatibility
+in vec4 v_color;
+out vec4 frag_color;
+void main()
+{
+    frag_color = v_color;
+}
+)";
+
+using StackDirections = std::array<std::pair<float, float>, zappy::graphics::renderers::ResourceStackRenderer::RESOURCE_TYPES>;
+
+// Same layout as TerrainRenderer::renderResourceStacks, computed once
+const StackDirections& stackDirections()
+{
+    static const StackDirections directions = [] {
+        StackDirections table;
+        const float angle_step = 2.0f * 3.14159f / 7.0f;
+        for (size_t i = 0; i < table.size(); ++i) {
+            table[i] = {std::cos(i * angle_step), std::sin(i * angle_step)};
+        }
+        return table;
+    }();
+    return directions;
+}
+
+std::vector<float> unitCube()
+{
+    // Coins : bit 0 = x, bit 1 = y, bit 2 = z
+    const int faces[6][4] = {
+        {2, 3, 7, 6}, {0, 1, 5, 4}, {4, 5, 7, 6},
+        {0, 1, 3, 2}, {0, 4, 6, 2}, {1, 5, 7, 3}
+    };
+    std::vector<float> vertices;
+
+    vertices.reserve(CUBE_VERTICES * 3);
+    for (const auto& face : faces) {
+        for (int corner : {face[0], face[1], face[2], face[0], face[2], face[3]}) {
+            vertices.push_back((corner & 1) ? 0.5f : -0.5f);
+            vertices.push_back((corner & 2) ? 1.0f : 0.0f);
+            vertices.push_back((corner & 4) ? 0.5f : -0.5f);
+        }
+    }
+    return vertices;
+}
+
+const void* bufferOffset(size_t offset)
+{
+    return reinterpret_cast<const void*>(offset);
+}
+
+}
+
+bool zappy::graphics::renderers::ResourceStackRenderer::StackStyle::operator==(const StackStyle& other) const
+{
+    return cube_size == other.cube_size && cube_height == other.cube_height &&
+           radius == other.radius && base_y == other.base_y &&
+           max_stack_height == other.max_stack_height && colors == other.colors;
+}
+
+zappy::graphics::renderers::ResourceStackRenderer::~ResourceStackRenderer()
+{
+    release();
+}
+
+bool zappy::graphics::renderers::ResourceStackRenderer::initialize()
+{
+    // glVertexAttribDivisor et les shaders 330 demandent OpenGL 3.3
+    if (!OpenGLUtils::isVersionAtLeast(3, 3)) {
+        return false;
+    }
+    _program = OpenGLUtils::createShaderProgram(STACK_VERTEX_SHADER, STACK_FRAGMENT_SHADER);
+    if (_program == 0) {
+        return false;
+    }
+    _size_location = glGetUniformLocation(_program, "u_size");
+
+    std::vector<float> cube = unitCube();
+    glGenVertexArrays(1, &_vertex_array);
+    glBindVertexArray(_vertex_array);
+
+    glGenBuffers(1, &_cube_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _cube_buffer);
+    glBufferData(GL_ARRAY_BUFFER, cube.size() * sizeof(float), cube.data(), GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), bufferOffset(0));
+
+    glGenBuffers(1, &_instance_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_buffer);
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), bufferOffset(offsetof(Instance, x)));
+    glVertexAttribDivisor(2, 1);
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), bufferOffset(offsetof(Instance, color)));
+    glVertexAttribDivisor(3, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    _stale = true;
+    return glGetError() == GL_NO_ERROR;
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::release()
+{
+    if (_program == 0) {
+        return;
+    }
+    GLuint buffers[] = {_cube_buffer, _instance_buffer};
+    glDeleteBuffers(2, buffers);
+    glDeleteVertexArrays(1, &_vertex_array);
+    OpenGLUtils::deleteShaderProgram(_program);
+    _program = 0;
+    _vertex_array = 0;
+    _cube_buffer = 0;
+    _instance_buffer = 0;
+    _instance_capacity = 0;
+    _instances.clear();
+    _tile_cubes.clear();
+    _tile_offsets.clear();
+    _stale = true;
+}
+
+zappy::graphics::renderers::ResourceStackRenderer::CubeCounts
+zappy::graphics::renderers::ResourceStackRenderer::countCubes(const zappy::game::world::ZappyTile& tile) const
+{
+    const int counts[RESOURCE_TYPES] = {tile.food, tile.linemate, tile.deraumere, tile.sibur,
+                                        tile.mendiane, tile.phiras, tile.thystame};
+    int max_cubes = std::min(_style.max_stack_height, 255);
+    CubeCounts cubes;
+
+    // Un cube pour 5 ressources, au moins un, comme renderResourceStack
+    for (int i = 0; i < RESOURCE_TYPES; ++i) {
+        int stack = std::min(std::max(1, (counts[i] + 4) / 5), max_cubes);
+        cubes[i] = static_cast<std::uint8_t>((counts[i] > 0 && stack > 0) ? stack : 0);
+    }
+    return cubes;
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::appendTileInstances(int x, int z, const CubeCounts& cubes,
+    std::vector<Instance>& out) const
+{
+    const auto& directions = stackDirections();
+    size_t stack = 0;
+
+    for (int i = 0; i < RESOURCE_TYPES; ++i) {
+        if (cubes[i] == 0) {
+            continue;
+        }
+        float pos_x = x + directions[stack].first * _style.radius;
+        float pos_z = z + directions[stack].second * _style.radius;
+        for (int level = 0; level < cubes[i]; ++level) {
+            float stack_y = _style.base_y + level * _style.cube_height + _style.cube_height / 2.0f;
+            out.push_back({pos_x, stack_y, pos_z, _style.colors[i]});
+        }
+        stack++;
+    }
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::rebuild(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map)
+{
+    size_t tiles = static_cast<size_t>(_width) * _height;
+
+    _tile_cubes.resize(tiles);
+    _tile_offsets.resize(tiles + 1);
+    _instances.clear();
+    for (size_t slot = 0; slot < tiles; ++slot) {
+        int tile = _layout.slotTile(static_cast<int>(slot));
+        int x = tile % _width;
+        int z = tile / _width;
+        _tile_offsets[slot] = _instances.size();
+        _tile_cubes[slot] = countCubes(world_map[z][x]);
+        appendTileInstances(x, z, _tile_cubes[slot], _instances);
+    }
+    _tile_offsets[tiles] = _instances.size();
+    upload(true);
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::patch(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    const zappy::game::world::TileChanges* changes)
+{
+    std::vector<size_t> candidates;
+    std::vector<size_t> changed;
+    bool resized = false;
+
+    // Slots à comparer, dans l'ordre des slots comme le veut la fusion plus bas
+    if (changes) {
+        changes->forEachTile([&](size_t index) {
+            candidates.push_back(static_cast<size_t>(_layout.tileSlot(static_cast<int>(index % _width),
+                                                                      static_cast<int>(index / _width))));
+        });
+        std::sort(candidates.begin(), candidates.end());
+    }
+    size_t count = changes ? candidates.size() : _tile_cubes.size();
+    for (size_t i = 0; i < count; ++i) {
+        size_t tile = changes ? candidates[i] : i;
+        int raster = _layout.slotTile(static_cast<int>(tile));
+        CubeCounts cubes = countCubes(world_map[raster / _width][raster % _width]);
+        if (cubes == _tile_cubes[tile]) {
+            continue;
+        }
+        size_t total = 0;
+        for (std::uint8_t count : cubes) {
+            total += count;
+        }
+        resized |= (total != _tile_offsets[tile + 1] - _tile_offsets[tile]);
+        _tile_cubes[tile] = cubes;
+        changed.push_back(tile);
+    }
+    if (changed.empty()) {
+        return;
+    }
+
+    if (!resized) {
+        // Même nombre de cubes : réécriture sur place, seules ces plages partent au GPU
+        std::vector<Instance> tile_instances;
+        for (size_t tile : changed) {
+            tile_instances.clear();
+            int raster = _layout.slotTile(static_cast<int>(tile));
+            appendTileInstances(raster % _width, raster / _width, _tile_cubes[tile], tile_instances);
+            std::copy(tile_instances.begin(), tile_instances.end(), _instances.begin() + _tile_offsets[tile]);
+            if (!_dirty_ranges.empty() && _dirty_ranges.back().second == _tile_offsets[tile]) {
+                _dirty_ranges.back().second = _tile_offsets[tile + 1];
+            } else {
+                _dirty_ranges.emplace_back(_tile_offsets[tile], _tile_offsets[tile + 1]);
+            }
+        }
+        upload(false);
+        return;
+    }
+
+    // Unchanged tiles are copied as they are, only the changed ones are rebuilt
+    std::vector<Instance> instances;
+    instances.reserve(_instances.size() + changed.size() * RESOURCE_TYPES);
+    size_t next_changed = 0;
+    size_t tiles = _tile_cubes.size();
+    for (size_t tile = 0; tile < tiles; ++tile) {
+        size_t first = instances.size();
+        if (next_changed < changed.size() && changed[next_changed] == tile) {
+            int raster = _layout.slotTile(static_cast<int>(tile));
+            appendTileInstances(raster % _width, raster / _width, _tile_cubes[tile], instances);
+            next_changed++;
+        } else {
+            instances.insert(instances.end(), _instances.begin() + _tile_offsets[tile],
+                             _instances.begin() + _tile_offsets[tile + 1]);
+        }
+        _tile_offsets[tile] = first;
+    }
+    _tile_offsets[tiles] = instances.size();
+    _instances.swap(instances);
+    upload(true);
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::upload(bool resized)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_buffer);
+    if (_instances.size() > _instance_capacity) {
+        // Marge pour ne pas réallouer à chaque ressource qui apparaît
+        _instance_capacity = _instances.size() + _instances.size() / 2 + 64;
+        glBufferData(GL_ARRAY_BUFFER, _instance_capacity * sizeof(Instance), nullptr, GL_DYNAMIC_DRAW);
+        resized = true;
+    }
+    if (resized) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, _instances.size() * sizeof(Instance), _instances.data());
+    } else {
+        for (const auto& range : _dirty_ranges) {
+            glBufferSubData(GL_ARRAY_BUFFER, range.first * sizeof(Instance),
+                            (range.second - range.first) * sizeof(Instance), &_instances[range.first]);
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    _dirty_ranges.clear();
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::update(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    std::uint64_t generation, const StackStyle& style, const zappy::game::world::TileChanges* changes)
+{
+    if (!isReady()) {
+        return;
+    }
+    int height = static_cast<int>(world_map.size());
+    int width = (height > 0) ? static_cast<int>(world_map[0].size()) : 0;
+
+    if (!(style == _style) || width != _width || height != _height) {
+        _style = style;
+        _width = width;
+        _height = height;
+        _layout.resize(width, height);
+        _stale = true;
+    }
+    if (!_stale && generation != 0 && generation == _generation) {
+        return;
+    }
+    if (_stale) {
+        rebuild(world_map);
+    } else {
+        patch(world_map, changes && changes->appliesTo(_generation) ? changes : nullptr);
+    }
+    _generation = generation;
+    _stale = false;
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::drawInstances(size_t first, size_t count) const
+{
+    if (count == 0) {
+        return;
+    }
+    // Sans glDrawArraysInstancedBaseInstance (4.2), la première instance passe par l'offset des attributs
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                          bufferOffset(first * sizeof(Instance) + offsetof(Instance, x)));
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance),
+                          bufferOffset(first * sizeof(Instance) + offsetof(Instance, color)));
+    glDrawArraysInstanced(GL_TRIANGLES, 0, CUBE_VERTICES, static_cast<GLsizei>(count));
+}
+
+void zappy::graphics::renderers::ResourceStackRenderer::draw(const ChunkGrid* visible, bool detail_only) const
+{
+    if (!isReady() || _instances.empty()) {
+        return;
+    }
+    glUseProgram(_program);
+    glUniform2f(_size_location, _style.cube_size, _style.cube_height);
+    glBindVertexArray(_vertex_array);
+    glBindBuffer(GL_ARRAY_BUFFER, _instance_buffer);
+    if (visible && visible->matches(_width, _height)) {
+        const auto& ranges = detail_only ? visible->getDetailRanges() : visible->getVisibleRanges();
+        for (const ChunkGrid::SlotRange& range : ranges) {
+            size_t first = _tile_offsets[range.first];
+            drawInstances(first, _tile_offsets[range.end] - first);
+        }
+    } else {
+        drawInstances(0, _instances.size());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+}
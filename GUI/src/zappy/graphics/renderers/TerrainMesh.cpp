@@ -0,0 +1,269 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** Terrain mesh
+*/
+
+#include "zappy/graphics/renderers/TerrainMesh.hpp"
+#include "zappy/graphics/utils/TextureManager.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+// Pour ne pas échantillonner le slot voisin de l'atlas avec le filtrage linéaire
+constexpr float ATLAS_INSET = 0.002f;
+
+float atlasU(int slot, float u)
+{
+    float slot_u = ATLAS_INSET + u * (1.0f - 2.0f * ATLAS_INSET);
+
+    return (slot + slot_u) / zappy::graphics::utils::TextureManager::ATLAS_SLOTS;
+}
+
+const void* bufferOffset(size_t offset)
+{
+    return reinterpret_cast<const void*>(offset);
+}
+
+}
+
+zappy::graphics::renderers::TerrainMesh::~TerrainMesh()
+{
+    release();
+}
+
+bool zappy::graphics::renderers::TerrainMesh::matches(int width, int height, float tile_size, float tile_height) const
+{
+    return isBuilt() && _width == width && _height == height &&
+           _tile_size == tile_size && _tile_height == tile_height;
+}
+
+void zappy::graphics::renderers::TerrainMesh::appendTile(int x, int z, std::vector<Vertex>& vertices,
+    std::vector<GLuint>& faces, std::vector<GLuint>& outlines) const
+{
+    using zappy::graphics::utils::TextureManager;
+    float h = _tile_size / 2.0f;
+    float fx = static_cast<float>(x);
+    float fz = static_cast<float>(z);
+    float top = _tile_height;
+    GLuint base = static_cast<GLuint>(vertices.size());
+
+    // Même ordre et mêmes coordonnées que TerrainRenderer::renderCubeFace
+    struct Face {
+        float nx, ny, nz;
+        float corners[4][3];
+        float uv[4][2];
+        int slot;
+    };
+    const Face cube[] = {
+        {0, 1, 0, {{-h, top, -h}, {h, top, -h}, {h, top, h}, {-h, top, h}},
+         {{0, 0}, {1, 0}, {1, 1}, {0, 1}}, TextureManager::ATLAS_GRASS_SLOT},
+        {0, -1, 0, {{-h, 0, -h}, {h, 0, -h}, {h, 0, h}, {-h, 0, h}},
+         {{0, 0}, {1, 0}, {1, 1}, {0, 1}}, TextureManager::ATLAS_DIRT_SLOT},
+        {0, 0, 1, {{-h, 0, h}, {h, 0, h}, {h, top, h}, {-h, top, h}},
+         {{0, 0}, {1, 0}, {1, 1}, {0, 1}}, TextureManager::ATLAS_DIRT_SLOT},
+        {0, 0, -1, {{h, 0, -h}, {-h, 0, -h}, {-h, top, -h}, {h, top, -h}},
+         {{1, 0}, {0, 0}, {0, 1}, {1, 1}}, TextureManager::ATLAS_DIRT_SLOT},
+        {-1, 0, 0, {{-h, 0, -h}, {-h, 0, h}, {-h, top, h}, {-h, top, -h}},
+         {{1, 0}, {0, 0}, {0, 1}, {1, 1}}, TextureManager::ATLAS_DIRT_SLOT},
+        {1, 0, 0, {{h, 0, h}, {h, 0, -h}, {h, top, -h}, {h, top, h}},
+         {{0, 0}, {1, 0}, {1, 1}, {0, 1}}, TextureManager::ATLAS_DIRT_SLOT},
+    };
+
+    for (const Face& face : cube) {
+        GLuint first = static_cast<GLuint>(vertices.size());
+        for (int i = 0; i < 4; ++i) {
+            vertices.push_back({fx + face.corners[i][0], face.corners[i][1], fz + face.corners[i][2],
+                                face.nx, face.ny, face.nz,
+                                atlasU(face.slot, face.uv[i][0]), face.uv[i][1]});
+        }
+        for (GLuint index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+            faces.push_back(first + index);
+        }
+    }
+
+    // Arêtes du cube : sommets 0-3 face du haut, 4-7 face du bas
+    const GLuint edges[OUTLINE_INDICES_PER_TILE] = {
+        4, 5, 5, 6, 6, 7, 7, 4,
+        0, 1, 1, 2, 2, 3, 3, 0,
+        4, 0, 5, 1, 6, 2, 7, 3
+    };
+    for (GLuint index : edges) {
+        outlines.push_back(base + index);
+    }
+}
+
+bool zappy::graphics::renderers::TerrainMesh::build(int width, int height, float tile_size, float tile_height)
+{
+    release();
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    _width = width;
+    _height = height;
+    _tile_size = tile_size;
+    _tile_height = tile_height;
+
+    size_t tiles = static_cast<size_t>(width) * height;
+    std::vector<Vertex> vertices;
+    std::vector<GLuint> faces;
+    std::vector<GLuint> outlines;
+    vertices.reserve(tiles * VERTICES_PER_TILE);
+    faces.reserve(tiles * FACE_INDICES_PER_TILE);
+    outlines.reserve(tiles * OUTLINE_INDICES_PER_TILE);
+    _layout.resize(width, height);
+    for (size_t slot = 0; slot < tiles; ++slot) {
+        int tile = _layout.slotTile(static_cast<int>(slot));
+        appendTile(tile % width, tile / width, vertices, faces, outlines);
+    }
+    _colors.assign(vertices.size(), sf::Color::White);
+    _dirty_tiles.clear();
+
+    glGenBuffers(1, &_vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+
+    glGenBuffers(1, &_color_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _color_buffer);
+    glBufferData(GL_ARRAY_BUFFER, _colors.size() * sizeof(sf::Color), _colors.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &_face_buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _face_buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, faces.size() * sizeof(GLuint), faces.data(), GL_STATIC_DRAW);
+
+    glGenBuffers(1, &_outline_buffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _outline_buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, outlines.size() * sizeof(GLuint), outlines.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+void zappy::graphics::renderers::TerrainMesh::release()
+{
+    GLuint buffers[] = {_vertex_buffer, _color_buffer, _face_buffer, _outline_buffer};
+
+    if (_vertex_buffer != 0) {
+        glDeleteBuffers(4, buffers);
+    }
+    _vertex_buffer = 0;
+    _color_buffer = 0;
+    _face_buffer = 0;
+    _outline_buffer = 0;
+    _width = 0;
+    _height = 0;
+    _colors.clear();
+    _dirty_tiles.clear();
+}
+
+bool zappy::graphics::renderers::TerrainMesh::setTileColors(int x, int y, const sf::Color& top, const sf::Color& side)
+{
+    if (x < 0 || x >= _width || y < 0 || y >= _height) {
+        return false;
+    }
+    int tile = _layout.tileSlot(x, y);
+    sf::Color* colors = &_colors[static_cast<size_t>(tile) * VERTICES_PER_TILE];
+
+    if (colors[0] == top && colors[VERTICES_PER_TILE - 1] == side) {
+        return false;
+    }
+
+    // La face du haut est la première, les 5 autres sont des côtés
+    for (int i = 0; i < VERTICES_PER_TILE; ++i) {
+        colors[i] = (i < 4) ? top : side;
+    }
+    _dirty_tiles.push_back(tile);
+    return true;
+}
+
+void zappy::graphics::renderers::TerrainMesh::uploadDirtyColors()
+{
+    if (_dirty_tiles.empty() || !isBuilt()) {
+        _dirty_tiles.clear();
+        return;
+    }
+    const size_t tile_bytes = VERTICES_PER_TILE * sizeof(sf::Color);
+
+    glBindBuffer(GL_ARRAY_BUFFER, _color_buffer);
+    // Une seule copie par suite de tiles consécutives
+    std::sort(_dirty_tiles.begin(), _dirty_tiles.end());
+    for (size_t start = 0; start < _dirty_tiles.size();) {
+        size_t end = start + 1;
+        while (end < _dirty_tiles.size() && _dirty_tiles[end] == _dirty_tiles[end - 1] + 1) {
+            ++end;
+        }
+        size_t first_tile = static_cast<size_t>(_dirty_tiles[start]);
+        glBufferSubData(GL_ARRAY_BUFFER, first_tile * tile_bytes, (end - start) * tile_bytes,
+                        &_colors[first_tile * VERTICES_PER_TILE]);
+        start = end;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    _dirty_tiles.clear();
+}
+
+void zappy::graphics::renderers::TerrainMesh::drawElements(GLenum mode, GLuint buffer, int indices_per_tile,
+    const ChunkGrid* visible, bool detail_only) const
+{
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    if (!visible || !visible->matches(_width, _height)) {
+        glDrawElements(mode, _width * _height * indices_per_tile, GL_UNSIGNED_INT, bufferOffset(0));
+        return;
+    }
+    // Un appel par suite de chunks visibles
+    const auto& ranges = detail_only ? visible->getDetailRanges() : visible->getVisibleRanges();
+    for (const ChunkGrid::SlotRange& range : ranges) {
+        glDrawElements(mode, (range.end - range.first) * indices_per_tile, GL_UNSIGNED_INT,
+                       bufferOffset(static_cast<size_t>(range.first) * indices_per_tile * sizeof(GLuint)));
+    }
+}
+
+void zappy::graphics::renderers::TerrainMesh::drawFaces(bool textured, const ChunkGrid* visible, bool detail_only) const
+{
+    if (!isBuilt()) {
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, x)));
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glNormalPointer(GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, nx)));
+    if (textured) {
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, u)));
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, _color_buffer);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, bufferOffset(0));
+
+    drawElements(GL_TRIANGLES, _face_buffer, FACE_INDICES_PER_TILE, visible, detail_only);
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void zappy::graphics::renderers::TerrainMesh::drawOutlines(const sf::Color& color, float line_width,
+    const ChunkGrid* visible, bool detail_only) const
+{
+    if (!isBuilt()) {
+        return;
+    }
+    glColor4ub(color.r, color.g, color.b, color.a);
+    glLineWidth(line_width);
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(Vertex), bufferOffset(offsetof(Vertex, x)));
+
+    drawElements(GL_LINES, _outline_buffer, OUTLINE_INDICES_PER_TILE, visible, detail_only);
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glLineWidth(1.0f);
+}
@@ -8,8 +8,24 @@
 #include "zappy/graphics/renderers/TerrainRenderer.hpp"
 #include "zappy/graphics/utils/OpenGLUtils.hpp"
 #include <iostream>
+#include <algorithm>
 #include <cmath>
 
+namespace {
+
+// Food, linemate, deraumere, sibur, mendiane, phiras, thystame
+const sf::Color RESOURCE_COLORS[zappy::graphics::renderers::ResourceStackRenderer::RESOURCE_TYPES] = {
+    sf::Color(255, 255, 0),     // Yellow
+    sf::Color(192, 192, 192),   // Silver
+    sf::Color(139, 69, 19),     // Brown
+    sf::Color(0, 100, 255),     // Blue
+    sf::Color(255, 0, 255),     // Magenta
+    sf::Color(255, 0, 0),       // Red
+    sf::Color(128, 0, 128)      // Purple
+};
+
+}
+
 zappy::graphics::renderers::TerrainRenderer::TerrainRenderer()
 {
     //std::cout << "🌍 TerrainRenderer created" << std::endl;
@@ -26,11 +42,23 @@ void zappy::graphics::renderers::TerrainRenderer::initialize(zappy::graphics::ut
     if (_initialized) return;
     
     _texture_manager = texture_manager;
+    if (!_resource_stacks.initialize()) {
+        _resource_stacks.release();
+        std::cerr << "[TerrainRenderer] No instancing support, resources drawn per tile" << std::endl;
+    }
     _initialized = true;
     
     //std::cout << "🌍 TerrainRenderer initialized!" << std::endl;
 }
 
+void zappy::graphics::renderers::TerrainRenderer::shutdown()
+{
+    _mesh.release();
+    _lod_mesh.release();
+    _resource_stacks.release();
+    _mesh_stale = true;
+}
+
 void zappy::graphics::renderers::TerrainRenderer::renderTile(int x, int z, const zappy::game::world::ZappyTile& tile)
 {
     if (!_initialized) return;
@@ -61,20 +89,20 @@ void zappy::graphics::renderers::TerrainRenderer::renderTile(int x, int z, const
     _tiles_rendered++;
 }
 
-void zappy::graphics::renderers::TerrainRenderer::renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map)
+void zappy::graphics::renderers::TerrainRenderer::renderTileMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    std::uint64_t generation, const zappy::game::world::TileChanges* changes)
 {
     resetStatistics();
+    _lod_drawn = false;
     
     // Render grid lines first if enabled and not on top
     if (_config.show_grid && !_config.grid_on_top) {
         renderGridLines(world_map);
     }
     
-    // Render all tiles
-    for (int y = 0; y < static_cast<int>(world_map.size()); y++) {
-        for (int x = 0; x < static_cast<int>(world_map[y].size()); x++) {
-            renderTile(x, y, world_map[y][x]);
-        }
+    // Render all tiles, one draw call for the faces when buffers are available
+    if (!_config.batched_rendering || !renderTerrainMesh(world_map, generation, changes)) {
+        renderVisibleTiles(world_map, false);
     }
     
     // Render grid lines on top if enabled
@@ -83,6 +111,177 @@ void zappy::graphics::renderers::TerrainRenderer::renderTileMap(const std::vecto
     }
 }
 
+bool zappy::graphics::renderers::TerrainRenderer::renderTerrainMesh(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    std::uint64_t generation, const zappy::game::world::TileChanges* changes)
+{
+    using zappy::graphics::utils::TextureManager;
+    
+    if (_mesh_failed || !_initialized || world_map.empty() || world_map[0].empty()) {
+        return false;
+    }
+    int height = static_cast<int>(world_map.size());
+    int width = static_cast<int>(world_map[0].size());
+    
+    if (!_mesh.matches(width, height, _config.tile_size, _config.tile_height)) {
+        if (!_mesh.build(width, height, _config.tile_size, _config.tile_height)) {
+            std::cerr << "[TerrainRenderer] Vertex buffers unavailable, immediate mode fallback" << std::endl;
+            _mesh.release();
+            _mesh_failed = true;
+            return false;
+        }
+        _mesh_stale = true;
+    }
+    
+    bool textured = _config.use_textures && _texture_manager &&
+                    _texture_manager->hasTexture(TextureManager::TextureType::TERRAIN_ATLAS);
+    const ChunkGrid* visible = visibleChunks(width, height);
+    bool aggregated = prepareLodMesh(visible, width, height);
+    
+    // Les couleurs ne sont recalculées que si le snapshot a changé, et
+    // seulement pour les tiles marquées quand le mesh est à jour de la base
+    if (_mesh_stale || textured != _mesh_textured || generation == 0 || generation != _mesh_generation) {
+        bool incremental = !_mesh_stale && textured == _mesh_textured && changes &&
+                           changes->appliesTo(_mesh_generation);
+        refreshTerrainColors(world_map, textured, incremental ? changes : nullptr);
+        _mesh_stale = false;
+        _mesh_textured = textured;
+        _mesh_generation = generation;
+    }
+    
+    if (textured) {
+        setupTexturedRendering();
+        _texture_manager->bindTexture(TextureManager::TextureType::TERRAIN_ATLAS);
+    } else {
+        setupColoredRendering();
+    }
+    _mesh.drawFaces(textured, visible, aggregated);
+    if (textured) {
+        _texture_manager->unbindTexture();
+    }
+    
+    if (aggregated) {
+        _lod_mesh.draw(visible->getAggregatedChunks());
+        _lod_drawn = true;
+    }
+    
+    if (_config.show_tile_outlines) {
+        OpenGLUtils::disableTexturing();
+        _mesh.drawOutlines(_config.outline_color, _config.outline_width, visible, aggregated);
+        OpenGLUtils::enableTexturing();
+    }
+    
+    if (_config.show_tile_coordinates) {
+        for (int z = 0; z < height; z++) {
+            for (int x = 0; x < width; x++) {
+                renderTileCoordinates(x, z);
+            }
+        }
+    }
+    
+    if (visible) {
+        _tiles_rendered += aggregated ? visible->getDetailTileCount() : visible->getVisibleTileCount();
+    } else {
+        _tiles_rendered += static_cast<size_t>(width) * height;
+    }
+    return true;
+}
+
+bool zappy::graphics::renderers::TerrainRenderer::prepareLodMesh(const ChunkGrid* visible, int width, int height)
+{
+    if (!visible || visible->getAggregatedChunks().empty() || _lod_failed) {
+        return false;
+    }
+    if (!_lod_mesh.matches(width, height, _config.tile_size, _config.tile_height)) {
+        if (!_lod_mesh.build(width, height, _config.tile_size, _config.tile_height)) {
+            std::cerr << "[TerrainRenderer] No density texture for this map, far chunks stay detailed" << std::endl;
+            _lod_failed = true;
+            return false;
+        }
+        // Les texels sont remplis avec les couleurs des tiles
+        _mesh_stale = true;
+    }
+    return true;
+}
+
+void zappy::graphics::renderers::TerrainRenderer::refreshTerrainColors(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    bool textured, const zappy::game::world::TileChanges* changes)
+{
+    int width = _mesh.getWidth();
+    
+    if (changes) {
+        changes->forEachTile([&](size_t index) {
+            int x = static_cast<int>(index % width);
+            int z = static_cast<int>(index / width);
+            refreshTileColor(world_map[z][x], x, z, textured);
+        });
+    } else {
+        for (int z = 0; z < _mesh.getHeight() && z < static_cast<int>(world_map.size()); z++) {
+            for (int x = 0; x < width && x < static_cast<int>(world_map[z].size()); x++) {
+                refreshTileColor(world_map[z][x], x, z, textured);
+            }
+        }
+    }
+    _mesh.uploadDirtyColors();
+    _lod_mesh.uploadDirtyTexels();
+}
+
+void zappy::graphics::renderers::TerrainRenderer::refreshTileColor(const zappy::game::world::ZappyTile& tile, int x, int z,
+    bool textured)
+{
+    sf::Color top;
+    sf::Color side;
+    
+    computeTileColors(tile, textured, top, side);
+    _mesh.setTileColors(x, z, top, side);
+    if (_lod_mesh.isBuilt()) {
+        _lod_mesh.setTileColor(x, z, computeDensityColor(tile));
+    }
+}
+
+void zappy::graphics::renderers::TerrainRenderer::computeTileColors(const zappy::game::world::ZappyTile& tile, bool textured,
+    sf::Color& top, sf::Color& side) const
+{
+    // Same colors as renderTexturedCube: white modulates the atlas
+    top = textured ? sf::Color::White : sf::Color(100, 200, 100);
+    side = textured ? sf::Color::White : sf::Color(150, 100, 50);
+    if (!textured) {
+        applyBrightnessBoost(top);
+        applyBrightnessBoost(side);
+    }
+    
+    // Tiles darken slightly as resources pile up on them
+    if (_config.color_variation) {
+        float shade = 1.0f - std::min(tile.getTotalResources(), 20) * 0.015f;
+        top.r = static_cast<sf::Uint8>(top.r * shade);
+        top.g = static_cast<sf::Uint8>(top.g * shade);
+        top.b = static_cast<sf::Uint8>(top.b * shade);
+    }
+}
+
+sf::Color zappy::graphics::renderers::TerrainRenderer::computeDensityColor(const zappy::game::world::ZappyTile& tile) const
+{
+    const int counts[ResourceStackRenderer::RESOURCE_TYPES] = {tile.food, tile.linemate, tile.deraumere, tile.sibur,
+                                                               tile.mendiane, tile.phiras, tile.thystame};
+    sf::Color color(100, 200, 100);
+    int dominant = 0;
+    int total = 0;
+    
+    // Herbe teintée par la ressource la plus présente, d'autant plus que la tile est chargée
+    for (int i = 0; i < ResourceStackRenderer::RESOURCE_TYPES; i++) {
+        total += counts[i];
+        if (counts[i] > counts[dominant]) {
+            dominant = i;
+        }
+    }
+    float weight = std::min(total, 10) * 0.08f;
+    const sf::Color& tint = RESOURCE_COLORS[dominant];
+    color.r = static_cast<sf::Uint8>(color.r + (tint.r - color.r) * weight);
+    color.g = static_cast<sf::Uint8>(color.g + (tint.g - color.g) * weight);
+    color.b = static_cast<sf::Uint8>(color.b + (tint.b - color.b) * weight);
+    applyBrightnessBoost(color);
+    return color;
+}
+
 void zappy::graphics::renderers::TerrainRenderer::renderTileRange(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
     int start_x, int start_z, int end_x, int end_z)
 {
@@ -122,13 +321,13 @@ void zappy::graphics::renderers::TerrainRenderer::renderResourceStacks(float x,
     };
     
     ResourceInfo resources[] = {
-        {tile.food, sf::Color(255, 255, 0)},           // Yellow
-        {tile.linemate, sf::Color(192, 192, 192)},     // Silver
-        {tile.deraumere, sf::Color(139, 69, 19)},      // Brown
-        {tile.sibur, sf::Color(0, 100, 255)},          // Blue
-        {tile.mendiane, sf::Color(255, 0, 255)},       // Magenta
-        {tile.phiras, sf::Color(255, 0, 0)},           // Red
-        {tile.thystame, sf::Color(128, 0, 128)}        // Purple
+        {tile.food, RESOURCE_COLORS[0]},
+        {tile.linemate, RESOURCE_COLORS[1]},
+        {tile.deraumere, RESOURCE_COLORS[2]},
+        {tile.sibur, RESOURCE_COLORS[3]},
+        {tile.mendiane, RESOURCE_COLORS[4]},
+        {tile.phiras, RESOURCE_COLORS[5]},
+        {tile.thystame, RESOURCE_COLORS[6]}
     };
     
     float offset_angle = 0.0f;
@@ -145,6 +344,75 @@ void zappy::graphics::renderers::TerrainRenderer::renderResourceStacks(float x,
     }
 }
 
+void zappy::graphics::renderers::TerrainRenderer::renderResourceMap(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    std::uint64_t generation, const zappy::game::world::TileChanges* changes)
+{
+    if (!_config.show_resource_stacks || world_map.empty()) {
+        return;
+    }
+    
+    // Un seul appel de dessin pour toutes les ressources de la carte
+    if (_config.batched_rendering && _resource_stacks.isReady()) {
+        _resource_stacks.update(world_map, generation, resourceStackStyle(), changes);
+        // Les chunks agrégés montrent déjà leurs ressources dans la texture de densité
+        _resource_stacks.draw(visibleChunks(static_cast<int>(world_map[0].size()), static_cast<int>(world_map.size())),
+                              _lod_drawn);
+        return;
+    }
+    renderVisibleTiles(world_map, true);
+}
+
+const zappy::graphics::renderers::ChunkGrid* zappy::graphics::renderers::TerrainRenderer::visibleChunks(int width, int height) const
+{
+    if (!_config.frustum_culling || !_chunks || !_chunks->isCulling() || !_chunks->matches(width, height)) {
+        return nullptr;
+    }
+    return _chunks;
+}
+
+void zappy::graphics::renderers::TerrainRenderer::renderVisibleTiles(const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
+    bool resources_only)
+{
+    int height = static_cast<int>(world_map.size());
+    int width = (height > 0) ? static_cast<int>(world_map[0].size()) : 0;
+    const ChunkGrid* visible = visibleChunks(width, height);
+    int chunks = visible ? static_cast<int>(visible->getVisibleChunks().size()) : 1;
+    
+    // Sans culling, un seul "chunk" couvre toute la carte
+    for (int i = 0; i < chunks; i++) {
+        int x0 = 0, z0 = 0, x1 = width, z1 = height;
+        if (visible) {
+            visible->chunkTiles(visible->getVisibleChunks()[i], x0, z0, x1, z1);
+        }
+        for (int z = z0; z < z1; z++) {
+            for (int x = x0; x < x1 && x < static_cast<int>(world_map[z].size()); x++) {
+                if (!resources_only) {
+                    renderTile(x, z, world_map[z][x]);
+                } else if (world_map[z][x].getTotalResources() > 0) {
+                    renderResourceStacks(static_cast<float>(x), 0.0f, static_cast<float>(z), world_map[z][x]);
+                }
+            }
+        }
+    }
+}
+
+zappy::graphics::renderers::ResourceStackRenderer::StackStyle zappy::graphics::renderers::TerrainRenderer::resourceStackStyle() const
+{
+    ResourceStackRenderer::StackStyle style;
+    
+    // Mêmes valeurs que renderResourceStacks et renderResourceStack
+    style.cube_size = _config.tile_size * _config.resource_cube_size_factor;
+    style.cube_height = _config.resource_cube_height;
+    style.radius = _config.tile_size * 0.25f;
+    style.base_y = _config.tile_height;
+    style.max_stack_height = _config.max_stack_height;
+    for (int i = 0; i < ResourceStackRenderer::RESOURCE_TYPES; i++) {
+        style.colors[i] = RESOURCE_COLORS[i];
+        applyBrightnessBoost(style.colors[i]);
+    }
+    return style;
+}
+
 void zappy::graphics::renderers::TerrainRenderer::renderResourceStack(float center_x, float center_y, float center_z,
     int count, const sf::Color& color,
     float cube_size, float cube_height, float angle_offset)
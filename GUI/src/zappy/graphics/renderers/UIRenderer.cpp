@@ -170,6 +170,21 @@ std::string zappy::graphics::renderers::UIRenderer::formatStatsText(const GameSt
     ss << "Players: " << stats.player_count << "\n";
     ss << "Zoom: " << std::fixed << std::setprecision(1) << stats.zoom_level << "x\n";
     ss << "Rotation: " << std::fixed << std::setprecision(0) << stats.rotation_degrees << "°\n";
+    ss << "Scene: " << std::fixed << std::setprecision(2) << stats.scene_time_ms << " ms"
+       << " (LOD " << (stats.lod_enabled ? "on" : "off") << ", L)\n";
+    
+    // Comparaison : chaque moyenne reste affichée quand on change de mode
+    auto average = [](float ms) {
+        std::ostringstream value;
+        if (ms > 0.0f) {
+            value << std::fixed << std::setprecision(2) << ms << " ms";
+        } else {
+            value << "-";
+        }
+        return value.str();
+    };
+    ss << "LOD on: " << average(stats.lod_on_time_ms) << " | off: " << average(stats.lod_off_time_ms) << "\n";
+    ss << "Chunks: " << stats.detailed_chunks << " detailed, " << stats.aggregated_chunks << " aggregated\n";
     
     return ss.str();
 }
@@ -299,7 +314,8 @@ zappy::graphics::renderers::UIRenderer::PlayerInfo zappy::graphics::renderers::U
 
 zappy::graphics::renderers::UIRenderer::TileInfo zappy::graphics::renderers::UIRenderer::createTileInfo(int x, int y, 
     const std::vector<std::vector<zappy::game::world::ZappyTile>>& world_map,
-    const std::map<int, zappy::game::entities::ZappyPlayer>& players) const
+    const std::map<int, zappy::game::entities::ZappyPlayer>& players,
+    const zappy::game::world::PlayerBuckets& buckets) const
 {
     TileInfo info;
     
@@ -318,12 +334,12 @@ zappy::graphics::renderers::UIRenderer::TileInfo zappy::graphics::renderers::UIR
     
     // Find players on this tile
     info.players_on_tile.clear();
-    for (const auto& player_pair : players) {
-        const zappy::game::entities::ZappyPlayer& player = player_pair.second;
-        if (player.x == x && player.y == y) {
-            info.players_on_tile.push_back(player);
+    buckets.forEachOnTile(x, y, [&](int player_id) {
+        auto player_it = players.find(player_id);
+        if (player_it != players.end()) {
+            info.players_on_tile.push_back(player_it->second);
         }
-    }
+    });
     
     return info;
 }
\ No newline at end of file
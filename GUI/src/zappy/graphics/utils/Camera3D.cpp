@@ -68,6 +68,7 @@ void zappy::graphics::utils::Camera3D::setupCamera()
     } else {
         setupFPSCamera();
     }
+    _frustum.extractFromGL();
 }
 
 void zappy::graphics::utils::Camera3D::setupOrbitalCamera()
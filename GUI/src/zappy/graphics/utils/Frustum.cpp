@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2025
+** Zappy
+** File description:
+** View frustum
+*/
+
+#include "zappy/graphics/utils/Frustum.hpp"
+#include <algorithm>
+#include <cmath>
+
+void zappy::graphics::utils::Frustum::extractFromGL()
+{
+    GLfloat projection[16];
+    GLfloat modelview[16];
+    float clip[16];
+
+    GLint viewport[4];
+
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    // gluLookAt ne fait que tourner et translater : oeil = -R^T * t
+    _eye.x = -(modelview[0] * modelview[12] + modelview[1] * modelview[13] + modelview[2] * modelview[14]);
+    _eye.y = -(modelview[4] * modelview[12] + modelview[5] * modelview[13] + modelview[6] * modelview[14]);
+    _eye.z = -(modelview[8] * modelview[12] + modelview[9] * modelview[13] + modelview[10] * modelview[14]);
+    _focal_pixels = projection[5] * viewport[3] / 2.0f;
+
+    // Matrices OpenGL en colonnes : clip = projection * modelview
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            clip[col * 4 + row] = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                clip[col * 4 + row] += projection[k * 4 + row] * modelview[col * 4 + k];
+            }
+        }
+    }
+
+    // Gribb-Hartmann: each plane is the last row plus or minus one of the others
+    auto row = [&clip](int r, int col) { return clip[col * 4 + r]; };
+    const int rows[6] = {0, 0, 1, 1, 2, 2};
+    _valid = true;
+    for (int i = 0; i < 6; ++i) {
+        float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+        Plane& plane = _planes[i];
+        plane.a = row(3, 0) + sign * row(rows[i], 0);
+        plane.b = row(3, 1) + sign * row(rows[i], 1);
+        plane.c = row(3, 2) + sign * row(rows[i], 2);
+        plane.d = row(3, 3) + sign * row(rows[i], 3);
+
+        float length = std::sqrt(plane.a * plane.a + plane.b * plane.b + plane.c * plane.c);
+        if (length < MathUtils::EPSILON) {
+            _valid = false;
+            return;
+        }
+        plane.a /= length;
+        plane.b /= length;
+        plane.c /= length;
+        plane.d /= length;
+    }
+}
+
+bool zappy::graphics::utils::Frustum::intersectsBox(const MathUtils::Vector3f& min, const MathUtils::Vector3f& max) const
+{
+    if (!_valid) {
+        return true;
+    }
+    for (const Plane& plane : _planes) {
+        // Coin de la boîte le plus loin dans la direction de la normale
+        float x = (plane.a >= 0.0f) ? max.x : min.x;
+        float y = (plane.b >= 0.0f) ? max.y : min.y;
+        float z = (plane.c >= 0.0f) ? max.z : min.z;
+        if (plane.a * x + plane.b * y + plane.c * z + plane.d < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+float zappy::graphics::utils::Frustum::pixelsPerUnit(float distance) const
+{
+    return _focal_pixels / std::max(distance, MathUtils::EPSILON);
+}
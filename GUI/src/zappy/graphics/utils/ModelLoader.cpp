@@ -15,6 +15,10 @@
 // Static member definition
 std::map<std::string, zappy::graphics::utils::Model*> zappy::graphics::utils::ModelLoader::_loaded_models;
 
+zappy::graphics::utils::Model::~Model() {
+    releaseGPU();
+}
+
 bool zappy::graphics::utils::Model::loadFromFile(const std::string& filepath) {
     //std::cout << "🐸 Loading Creeper model: " << filepath << std::endl;
     
@@ -29,6 +33,8 @@ bool zappy::graphics::utils::Model::loadFromFile(const std::string& filepath) {
     }
     
     calculateBoundingBox();
+    // Envoyé une fois au GPU, Mesh::render garde le mode immédiat en secours
+    uploadToGPU();
     _loaded = true;
     
     //std::cout << "✅ Creeper model loaded successfully!" << std::endl;
@@ -264,15 +270,72 @@ void zappy::graphics::utils::Model::render(const MathUtils::Vector3f& position,
     glPopMatrix();
 }
 
+bool zappy::graphics::utils::Model::uploadToGPU() {
+    std::vector<float> data;
+    
+    releaseGPU();
+    for (auto& mesh : _meshes) {
+        mesh.first_vertex = static_cast<GLint>(data.size() / 8);
+        mesh.has_texcoords = false;
+        for (const auto& vertex : mesh.vertices) {
+            mesh.has_texcoords |= (vertex.texCoords.x != 0.0f || vertex.texCoords.y != 0.0f);
+            data.insert(data.end(), {vertex.position.x, vertex.position.y, vertex.position.z,
+                                     vertex.normal.x, vertex.normal.y, vertex.normal.z,
+                                     vertex.texCoords.x, vertex.texCoords.y});
+        }
+    }
+    if (data.empty()) {
+        return false;
+    }
+    
+    glGenBuffers(1, &_vertex_buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _vertex_buffer);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if (glGetError() != GL_NO_ERROR || _vertex_buffer == 0) {
+        releaseGPU();
+        return false;
+    }
+    
+    _vertex_count = static_cast<GLsizei>(data.size() / 8);
+    for (auto& mesh : _meshes) {
+        mesh.vertex_buffer = _vertex_buffer;
+    }
+    return true;
+}
+
+void zappy::graphics::utils::Model::releaseGPU() {
+    if (_vertex_buffer != 0) {
+        glDeleteBuffers(1, &_vertex_buffer);
+    }
+    _vertex_buffer = 0;
+    _vertex_count = 0;
+    for (auto& mesh : _meshes) {
+        mesh.vertex_buffer = 0;
+    }
+}
+
 void Mesh::render() const {
     if (vertices.empty()) return;
     
-    bool has_texcoords = false;
-    for (const auto& vertex : vertices) {
-        if (vertex.texCoords.x != 0.0f || vertex.texCoords.y != 0.0f) {
-            has_texcoords = true;
-            break;
+    if (vertex_buffer != 0) {
+        const GLsizei stride = zappy::graphics::utils::Model::GPU_VERTEX_STRIDE;
+        
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(3, GL_FLOAT, stride, reinterpret_cast<const void*>(0));
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glNormalPointer(GL_FLOAT, stride, reinterpret_cast<const void*>(3 * sizeof(float)));
+        if (has_texcoords) {
+            glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+            glTexCoordPointer(2, GL_FLOAT, stride, reinterpret_cast<const void*>(6 * sizeof(float)));
         }
+        glDrawArrays(GL_TRIANGLES, first_vertex, static_cast<GLsizei>(vertices.size()));
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return;
     }
     
     glBegin(GL_TRIANGLES);
@@ -6,6 +6,7 @@
 */
 
 #include "zappy/graphics/utils/OpenGLUtils.hpp"
+#include <cstdio>
 #include <iostream>
 
 namespace OpenGLUtils {
@@ -155,6 +156,70 @@ GLuint createTexture(const sf::Image& image)
     return texture_id;
 }
 
+bool isVersionAtLeast(int major, int minor)
+{
+    int context_major = 0;
+    int context_minor = 0;
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    
+    if (!version || std::sscanf(version, "%d.%d", &context_major, &context_minor) != 2) {
+        return false;
+    }
+    return context_major > major || (context_major == major && context_minor >= minor);
+}
+
+static GLuint compileShader(GLenum stage, const char* source)
+{
+    GLuint shader = glCreateShader(stage);
+    GLint compiled = GL_FALSE;
+    
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled != GL_TRUE) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "❌ Shader compilation failed: " << log << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+GLuint createShaderProgram(const char* vertex_source, const char* fragment_source)
+{
+    GLuint vertex = compileShader(GL_VERTEX_SHADER, vertex_source);
+    GLuint fragment = compileShader(GL_FRAGMENT_SHADER, fragment_source);
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    
+    if (vertex != 0 && fragment != 0) {
+        program = glCreateProgram();
+        glAttachShader(program, vertex);
+        glAttachShader(program, fragment);
+        glLinkProgram(program);
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (linked != GL_TRUE) {
+            char log[1024];
+            glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+            std::cerr << "❌ Shader link failed: " << log << std::endl;
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    // Le programme garde les étapes liées, les shaders peuvent partir
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+    return program;
+}
+
+void deleteShaderProgram(GLuint program)
+{
+    if (program != 0) {
+        glDeleteProgram(program);
+    }
+}
+
 void bindTexture(GLuint texture_id)
 {
     glBindTexture(GL_TEXTURE_2D, texture_id);
@@ -35,6 +35,46 @@ void zappy::graphics::utils::TextureManager::loadDefaultTextures()
     } else {
         //std::cout << "❌ Could not find " << DEFAULT_DIRT_PATH << std::endl;
     }
+    
+    // Atlas used by the terrain mesh, one texture bind for the whole map
+    loadAtlasTexture(TextureType::TERRAIN_ATLAS, {DEFAULT_GRASS_PATH, DEFAULT_DIRT_PATH});
+}
+
+bool zappy::graphics::utils::TextureManager::loadAtlasTexture(TextureType type, const std::vector<std::string>& filepaths)
+{
+    std::vector<sf::Image> images(filepaths.size());
+    
+    if (images.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < filepaths.size(); ++i) {
+        if (!images[i].loadFromFile(filepaths[i]) || images[i].getSize() != images[0].getSize()) {
+            return false;
+        }
+    }
+    
+    sf::Vector2u slot_size = images[0].getSize();
+    sf::Image atlas;
+    atlas.create(slot_size.x * images.size(), slot_size.y);
+    for (size_t i = 0; i < images.size(); ++i) {
+        atlas.copy(images[i], slot_size.x * i, 0);
+    }
+    
+    // Pas de répétition : les faces ne doivent pas déborder sur le slot voisin
+    TextureConfig config;
+    config.wrap_s = GL_CLAMP_TO_EDGE;
+    config.wrap_t = GL_CLAMP_TO_EDGE;
+    
+    deleteTexture(type);
+    GLuint texture_id = createTextureFromImage(atlas, config);
+    if (texture_id == 0) {
+        return false;
+    }
+    
+    _textures[type] = texture_id;
+    _textures_loaded++;
+    _memory_usage += atlas.getSize().x * atlas.getSize().y * 4;
+    return true;
 }
 
 bool zappy::graphics::utils::TextureManager::loadTexture(TextureType type, const std::string& filepath)
@@ -250,6 +290,7 @@ std::string zappy::graphics::utils::TextureManager::textureTypeToString(TextureT
         case TextureType::DIRT: return "dirt";
         case TextureType::STONE: return "stone";
         case TextureType::WATER: return "water";
+        case TextureType::TERRAIN_ATLAS: return "terrain atlas";
         case TextureType::CUSTOM: return "custom";
         default: return "unknown";
     }
@@ -128,6 +128,10 @@ void zappy::input::InputHandler::processActionKeys(sf::Keyboard::Key key)
             _state.toggle_fps_mode = true;
             break;
             
+        case sf::Keyboard::L:
+            _state.toggle_lod = true;
+            break;
+            
         case sf::Keyboard::H:
             printAllControls();
             break;
@@ -447,6 +451,7 @@ void zappy::input::InputHandler::clearFrameFlags()
     _state.tile_clicked = false;
     _state.player_clicked = false;
     _state.toggle_fps_mode = false;
+    _state.toggle_lod = false;
 }
 
 void zappy::input::InputHandler::printAllControls() const
@@ -464,6 +469,7 @@ void zappy::input::InputHandler::printAllControls() const
     
     std::cout << "\n🎯 === FPS MODE ===" << std::endl;
     std::cout << "[SPACE]        - Toggle FPS mode ON/OFF" << std::endl;
+    std::cout << "[L]            - Toggle level of detail" << std::endl;
     std::cout << "Mouse          - Look around (FPS mode)" << std::endl;
     std::cout << "[W/A/S/D]      - Move forward/left/back/right (FPS mode)" << std::endl;
     std::cout << "[Shift]        - Move up (FPS mode)" << std::endl;
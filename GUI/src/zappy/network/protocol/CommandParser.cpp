@@ -9,6 +9,43 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <charconv>
+
+namespace {
+    // Mêmes séparateurs que l'ancien découpage par std::stringstream :
+    // ' ', '\t', '\n', '\v', '\f', '\r'. Un test direct évite le parcours
+    // d'un ensemble de caractères de find_first_of.
+    inline bool isSeparator(char c) {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    size_t skipSeparators(std::string_view text, size_t pos) {
+        while (pos < text.size() && isSeparator(text[pos])) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    size_t findSeparator(std::string_view text, size_t pos) {
+        while (pos < text.size() && !isSeparator(text[pos])) {
+            ++pos;
+        }
+        return pos;
+    }
+
+    // Entier positif d'au plus 9 chiffres, sans signe : tout autre jeton
+    // renvoie false et la ligne repasse par from_chars
+    bool readDigits(const char*& p, const char* end, int& value) {
+        const char* first = p;
+
+        value = 0;
+        while (p < end && p - first < 9 && static_cast<unsigned char>(*p - '0') <= 9) {
+            value = value * 10 + (*p - '0');
+            ++p;
+        }
+        return p != first && (p == end || isSeparator(*p));
+    }
+}
 
 zappy::network::protocol::CommandParser::CommandParser(std::shared_ptr<zappy::game::world::SharedGameState> game_state)
     : _game_state(game_state) {
@@ -17,66 +54,140 @@ zappy::network::protocol::CommandParser::CommandParser(std::shared_ptr<zappy::ga
 
 void zappy::network::protocol::CommandParser::setupCommandHandlers() {
     // Commandes principales du protocole GUI
-    _command_handlers["msz"] = [this](const auto& params) { handleMapSize(params); };
-    _command_handlers["bct"] = [this](const auto& params) { handleTileContent(params); };
-    _command_handlers["tna"] = [this](const auto& params) { handleTeamNames(params); };
+    addHandler("bct", &zappy::network::protocol::CommandParser::handleTileContent);
+    addHandler("msz", &zappy::network::protocol::CommandParser::handleMapSize);
+    addHandler("tna", &zappy::network::protocol::CommandParser::handleTeamNames);
     
     // Gestion des joueurs
-    _command_handlers["pnw"] = [this](const auto& params) { handleNewPlayer(params); };
-    _command_handlers["ppo"] = [this](const auto& params) { handlePlayerPosition(params); };
-    _command_handlers["plv"] = [this](const auto& params) { handlePlayerLevel(params); };
-    _command_handlers["pin"] = [this](const auto& params) { handlePlayerInventory(params); };
-    _command_handlers["pex"] = [this](const auto& params) { handlePlayerExpulsion(params); };
-    _command_handlers["pbc"] = [this](const auto& params) { handlePlayerBroadcast(params); };
-    _command_handlers["pdi"] = [this](const auto& params) { handlePlayerDeath(params); };
+    addHandler("pnw", &zappy::network::protocol::CommandParser::handleNewPlayer);
+    addHandler("ppo", &zappy::network::protocol::CommandParser::handlePlayerPosition);
+    addHandler("plv", &zappy::network::protocol::CommandParser::handlePlayerLevel);
+    addHandler("pin", &zappy::network::protocol::CommandParser::handlePlayerInventory);
+    addHandler("pex", &zappy::network::protocol::CommandParser::handlePlayerExpulsion);
+    addHandler("pbc", &zappy::network::protocol::CommandParser::handlePlayerBroadcast);
+    addHandler("pdi", &zappy::network::protocol::CommandParser::handlePlayerDeath);
     
     // Gestion des incantations
-    _command_handlers["pic"] = [this](const auto& params) { handleIncantationStart(params); };
-    _command_handlers["pie"] = [this](const auto& params) { handleIncantationEnd(params); };
+    addHandler("pic", &zappy::network::protocol::CommandParser::handleIncantationStart);
+    addHandler("pie", &zappy::network::protocol::CommandParser::handleIncantationEnd);
     
     // Gestion des œufs
-    _command_handlers["pfk"] = [this](const auto& params) { handleEggLaying(params); };
-    _command_handlers["enw"] = [this](const auto& params) { handleNewEgg(params); };
-    _command_handlers["ebo"] = [this](const auto& params) { handleEggConnection(params); };
-    _command_handlers["edi"] = [this](const auto& params) { handleEggDeath(params); };
+    addHandler("pfk", &zappy::network::protocol::CommandParser::handleEggLaying);
+    addHandler("enw", &zappy::network::protocol::CommandParser::handleNewEgg);
+    addHandler("ebo", &zappy::network::protocol::CommandParser::handleEggConnection);
+    addHandler("edi", &zappy::network::protocol::CommandParser::handleEggDeath);
     
     // Gestion des ressources
-    _command_handlers["pdr"] = [this](const auto& params) { handleResourceDrop(params); };
-    _command_handlers["pgt"] = [this](const auto& params) { handleResourceTake(params); };
+    addHandler("pdr", &zappy::network::protocol::CommandParser::handleResourceDrop);
+    addHandler("pgt", &zappy::network::protocol::CommandParser::handleResourceTake);
     
     // Gestion du jeu
-    _command_handlers["sgt"] = [this](const auto& params) { handleTimeUnit(params); };
-    _command_handlers["sst"] = [this](const auto& params) { handleTimeUnitSet(params); };
-    _command_handlers["seg"] = [this](const auto& params) { handleEndGame(params); };
-    _command_handlers["smg"] = [this](const auto& params) { handleServerMessage(params); };
+    addHandler("sgt", &zappy::network::protocol::CommandParser::handleTimeUnit);
+    addHandler("sst", &zappy::network::protocol::CommandParser::handleTimeUnitSet);
+    addHandler("seg", &zappy::network::protocol::CommandParser::handleEndGame);
+    addHandler("smg", &zappy::network::protocol::CommandParser::handleServerMessage);
     
     // Gestion des erreurs
-    _command_handlers["suc"] = [this](const auto& params) { handleUnknownCommand(params); };
-    _command_handlers["sbp"] = [this](const auto& params) { handleBadParameter(params); };
+    addHandler("suc", &zappy::network::protocol::CommandParser::handleUnknownCommand);
+    addHandler("sbp", &zappy::network::protocol::CommandParser::handleBadParameter);
+}
+
+void zappy::network::protocol::CommandParser::addHandler(const char* name, Handler handler) {
+    _command_handlers.push_back({opcode(name), handler});
 }
 
-void zappy::network::protocol::CommandParser::parseCommand(const std::string& command, const std::vector<std::string>& parameters) {
+zappy::network::protocol::CommandParser::Handler zappy::network::protocol::CommandParser::findHandler(std::uint32_t code) const {
+    for (const auto& entry : _command_handlers) {
+        if (entry.opcode == code) {
+            return entry.handler;
+        }
+    }
+    return nullptr;
+}
+
+std::uint32_t zappy::network::protocol::CommandParser::opcodeOf(std::string_view command) {
+    // 0 ne correspond à aucune commande
+    return command.size() == 3 ? opcode(command.data()) : 0;
+}
+
+void zappy::network::protocol::CommandParser::tokenize(std::string_view text, TokenList& tokens) {
+    tokens.count = 0;
+    size_t pos = skipSeparators(text, 0);
+
+    while (pos < text.size()) {
+        if (tokens.count + 1 == TokenList::MAX_TOKENS) {
+            size_t last = text.size();
+            while (isSeparator(text[last - 1])) {
+                --last;
+            }
+            tokens.tokens[tokens.count++] = text.substr(pos, last - pos);
+            return;
+        }
+        size_t end = findSeparator(text, pos);
+        tokens.tokens[tokens.count++] = text.substr(pos, end - pos);
+        pos = skipSeparators(text, end);
+    }
+}
+
+void zappy::network::protocol::CommandParser::parseMessage(std::string_view message) {
+    size_t start = skipSeparators(message, 0);
+    if (start == message.size()) {
+        return;
+    }
+    size_t end = findSeparator(message, start);
+    std::string_view command = message.substr(start, end - start);
+    TokenList parameters;
+
+    // mct envoie une ligne bct par case, lue ici sans TokenList
+    zappy::game::world::ZappyTile tile;
+    if (end != message.size() && opcodeOf(command) == opcode("bct")
+        && parseTileLine(message.substr(end), tile)) {
+        if (validateCoordinates(tile.x, tile.y)) {
+            _tile_batch.push_back(tile);
+        }
+        return;
+    }
+    if (end != message.size()) {
+        tokenize(message.substr(end), parameters);
+    }
+    parseCommand(command, parameters);
+}
+
+void zappy::network::protocol::CommandParser::parseCommand(std::string_view command, const TokenList& parameters) {
     logCommand(command, parameters);
     
-    auto it = _command_handlers.find(command);
-    if (it != _command_handlers.end()) {
+    std::uint32_t code = opcodeOf(command);
+    // Les autres commandes voient les bct précédents déjà appliqués
+    if (code != opcode("bct")) {
+        flushTileUpdates();
+    }
+    Handler handler = findHandler(code);
+    if (handler) {
         try {
-            it->second(parameters);
+            (this->*handler)(parameters);
         } catch (const std::exception& e) {
-            logError("Exception while handling command '" + command + "': " + e.what());
+            logError("Exception while handling command '" + std::string(command) + "': " + e.what());
         }
     } else {
-        logWarning("Unknown command: " + command);
+        logWarning("Unknown command: " + std::string(command));
     }
 }
 
-bool zappy::network::protocol::CommandParser::isValidCommand(const std::string& command) const {
-    return _command_handlers.find(command) != _command_handlers.end();
+bool zappy::network::protocol::CommandParser::isValidCommand(std::string_view command) const {
+    return findHandler(opcodeOf(command)) != nullptr;
+}
+
+void zappy::network::protocol::CommandParser::flushTileUpdates() {
+    if (_tile_batch.empty()) {
+        return;
+    }
+    _game_state->updateTiles(_tile_batch);
+    _tile_batch.clear();
 }
 
 // Handlers pour les commandes principales
 
-void zappy::network::protocol::CommandParser::handleMapSize(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleMapSize(const TokenList& params) {
     if (!validateParameters(params, 2, "msz")) return;
     
     int width = parseInteger(params[0], "map width");
@@ -90,24 +201,19 @@ void zappy::network::protocol::CommandParser::handleMapSize(const std::vector<st
     _game_state->setMapSize(width, height);
 }
 
-void zappy::network::protocol::CommandParser::handleTileContent(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleTileContent(const TokenList& params) {
     if (!validateParameters(params, 9, "bct")) return;
     
-    int x = parseInteger(params[0], "tile x");
-    int y = parseInteger(params[1], "tile y");
+    zappy::game::world::ZappyTile tile(parseInteger(params[0], "tile x"),
+                                       parseInteger(params[1], "tile y"));
     
-    if (!validateCoordinates(x, y)) return;
-    
-    std::vector<int> resources = parseResourceList(params, 2);
-    if (resources.size() != 7) {
-        logError("Invalid resource count in bct command");
-        return;
-    }
+    if (!validateCoordinates(tile.x, tile.y)) return;
     
-    _game_state->updateTile(x, y, resources);
+    parseResources(params, 2, tile);
+    _tile_batch.push_back(tile);
 }
 
-void zappy::network::protocol::CommandParser::handleTeamNames(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleTeamNames(const TokenList& params) {
     static bool teams_finalized = false;
     
     if (params.empty() || teams_finalized) {
@@ -136,13 +242,13 @@ void zappy::network::protocol::CommandParser::handleTeamNames(const std::vector<
     }
 }
 
-void zappy::network::protocol::CommandParser::handleNewPlayer(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleNewPlayer(const TokenList& params) {
     if (!validateParameters(params, 6, "pnw")) return;
     
     // Format: pnw #n X Y O L N
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -158,13 +264,13 @@ void zappy::network::protocol::CommandParser::handleNewPlayer(const std::vector<
     _game_state->addPlayer(player_id, x, y, orientation, level, team);
 }
 
-void zappy::network::protocol::CommandParser::handlePlayerPosition(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerPosition(const TokenList& params) {
     if (!validateParameters(params, 4, "ppo")) return;
     
     // Format: ppo #n X Y O
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -178,13 +284,13 @@ void zappy::network::protocol::CommandParser::handlePlayerPosition(const std::ve
     _game_state->updatePlayerPosition(player_id, x, y, orientation);
 }
 
-void zappy::network::protocol::CommandParser::handlePlayerLevel(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerLevel(const TokenList& params) {
     if (!validateParameters(params, 2, "plv")) return;
     
     // Format: plv #n L
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -199,13 +305,13 @@ void zappy::network::protocol::CommandParser::handlePlayerLevel(const std::vecto
     _game_state->updatePlayerLevel(player_id, level);
 }
 
-void zappy::network::protocol::CommandParser::handlePlayerInventory(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerInventory(const TokenList& params) {
     if (!validateParameters(params, 10, "pin")) return;
     
     // Format: pin #n X Y q0 q1 q2 q3 q4 q5 q6
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -229,17 +335,17 @@ void zappy::network::protocol::CommandParser::handlePlayerInventory(const std::v
     event.player_id = player_id;
     event.x = x;
     event.y = y;
-    event.message = "inventory_updated";
+    event.message = _game_state->internEventString("inventory_updated");
     _game_state->addEvent(event);
 }
 
-void zappy::network::protocol::CommandParser::handlePlayerDeath(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerDeath(const TokenList& params) {
     if (!validateParameters(params, 1, "pdi")) return;
     
     // Format: pdi #n
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -247,14 +353,14 @@ void zappy::network::protocol::CommandParser::handlePlayerDeath(const std::vecto
     _game_state->removePlayer(player_id);
 }
 
-void zappy::network::protocol::CommandParser::handleTimeUnit(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleTimeUnit(const TokenList& params) {
     if (!validateParameters(params, 1, "sgt")) return;
     
     int time_unit = parseInteger(params[0], "time unit");
     _game_state->setTimeUnit(time_unit);
 }
 
-void zappy::network::protocol::CommandParser::handleEndGame(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleEndGame(const TokenList& params) {
     if (!validateParameters(params, 1, "seg")) return;
     
     std::string winner = parseString(params[0]);
@@ -263,13 +369,13 @@ void zappy::network::protocol::CommandParser::handleEndGame(const std::vector<st
 
 // Handlers pour les commandes complètes
 
-void zappy::network::protocol::CommandParser::handlePlayerExpulsion(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerExpulsion(const TokenList& params) {
     if (!validateParameters(params, 1, "pex")) return;
     
     // Format: pex #n
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -279,19 +385,19 @@ void zappy::network::protocol::CommandParser::handlePlayerExpulsion(const std::v
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::PLAYER_MOVED; // Réutiliser le type existant
     event.player_id = player_id;
-    event.message = "expelled";
+    event.message = _game_state->internEventString("expelled");
     _game_state->addEvent(event);
     
     logCommand("pex", params);
 }
 
-void zappy::network::protocol::CommandParser::handlePlayerBroadcast(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handlePlayerBroadcast(const TokenList& params) {
     if (!validateParameters(params, 2, "pbc")) return;
     
     // Format: pbc #n M
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -303,13 +409,13 @@ void zappy::network::protocol::CommandParser::handlePlayerBroadcast(const std::v
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::BROADCAST_RECEIVED;
     event.player_id = player_id;
-    event.message = message;
+    event.text = _game_state->copyEventText(message);
     _game_state->addEvent(event);
     
     logCommand("pbc", params);
 }
 
-void zappy::network::protocol::CommandParser::handleIncantationStart(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleIncantationStart(const TokenList& params) {
     if (!validateParameters(params, 4, "pic")) return;
     
     // Format: pic X Y L #n #n ...
@@ -327,8 +433,8 @@ void zappy::network::protocol::CommandParser::handleIncantationStart(const std::
     event.type = zappy::game::world::GameEvent::INCANTATION_STARTED;
     event.x = x;
     event.y = y;
-    event.data["level"] = level;
-    event.data["player_count"] = static_cast<int>(players.size());
+    event.level = level;
+    event.player_count = static_cast<int>(players.size());
     
     if (!players.empty()) {
         event.player_id = players[0]; // Premier joueur comme référence
@@ -338,7 +444,7 @@ void zappy::network::protocol::CommandParser::handleIncantationStart(const std::
     logCommand("pic", params);
 }
 
-void zappy::network::protocol::CommandParser::handleIncantationEnd(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleIncantationEnd(const TokenList& params) {
     if (!validateParameters(params, 3, "pie")) return;
     
     // Format: pie X Y R
@@ -353,20 +459,20 @@ void zappy::network::protocol::CommandParser::handleIncantationEnd(const std::ve
     event.type = zappy::game::world::GameEvent::INCANTATION_ENDED;
     event.x = x;
     event.y = y;
-    event.data["result"] = result;
-    event.message = (result == 1) ? "success" : "failure";
+    event.result = result;
+    event.message = _game_state->internEventString(result == 1 ? "success" : "failure");
     
     _game_state->addEvent(event);
     logCommand("pie", params);
 }
 
-void zappy::network::protocol::CommandParser::handleEggLaying(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleEggLaying(const TokenList& params) {
     if (!validateParameters(params, 1, "pfk")) return;
     
     // Format: pfk #n
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -381,20 +487,20 @@ void zappy::network::protocol::CommandParser::handleEggLaying(const std::vector<
     logCommand("pfk", params);
 }
 
-void zappy::network::protocol::CommandParser::handleNewEgg(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleNewEgg(const TokenList& params) {
     if (!validateParameters(params, 4, "enw")) return;
     
     // Format: enw #e #n X Y
-    std::string egg_str = params[0];
-    std::string player_str = params[1];
+    std::string_view egg_str = params[0];
+    std::string_view player_str = params[1];
     
     if (egg_str.empty() || egg_str[0] != '#') {
-        logError("Invalid egg ID format: " + egg_str);
+        logError("Invalid egg ID format: " + std::string(egg_str));
         return;
     }
     
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -411,19 +517,19 @@ void zappy::network::protocol::CommandParser::handleNewEgg(const std::vector<std
     event.player_id = player_id;
     event.x = x;
     event.y = y;
-    event.data["egg_id"] = egg_id;
+    event.egg_id = egg_id;
     
     _game_state->addEvent(event);
     logCommand("enw", params);
 }
 
-void zappy::network::protocol::CommandParser::handleEggConnection(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleEggConnection(const TokenList& params) {
     if (!validateParameters(params, 1, "ebo")) return;
     
     // Format: ebo #e
-    std::string egg_str = params[0];
+    std::string_view egg_str = params[0];
     if (egg_str.empty() || egg_str[0] != '#') {
-        logError("Invalid egg ID format: " + egg_str);
+        logError("Invalid egg ID format: " + std::string(egg_str));
         return;
     }
     
@@ -433,20 +539,20 @@ void zappy::network::protocol::CommandParser::handleEggConnection(const std::vec
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::EGG_LAID; // Réutiliser pour l'instant
     event.player_id = -1; // Pas de joueur spécifique
-    event.data["egg_id"] = egg_id;
-    event.message = "egg_connected";
+    event.egg_id = egg_id;
+    event.message = _game_state->internEventString("egg_connected");
     
     _game_state->addEvent(event);
     logCommand("ebo", params);
 }
 
-void zappy::network::protocol::CommandParser::handleEggDeath(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleEggDeath(const TokenList& params) {
     if (!validateParameters(params, 1, "edi")) return;
     
     // Format: edi #e
-    std::string egg_str = params[0];
+    std::string_view egg_str = params[0];
     if (egg_str.empty() || egg_str[0] != '#') {
-        logError("Invalid egg ID format: " + egg_str);
+        logError("Invalid egg ID format: " + std::string(egg_str));
         return;
     }
     
@@ -456,20 +562,20 @@ void zappy::network::protocol::CommandParser::handleEggDeath(const std::vector<s
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::PLAYER_DIED; // Réutiliser pour l'instant
     event.player_id = -1; // Pas de joueur spécifique
-    event.data["egg_id"] = egg_id;
-    event.message = "egg_died";
+    event.egg_id = egg_id;
+    event.message = _game_state->internEventString("egg_died");
     
     _game_state->addEvent(event);
     logCommand("edi", params);
 }
 
-void zappy::network::protocol::CommandParser::handleResourceDrop(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleResourceDrop(const TokenList& params) {
     if (!validateParameters(params, 2, "pdr")) return;
     
     // Format: pdr #n i
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -493,21 +599,21 @@ void zappy::network::protocol::CommandParser::handleResourceDrop(const std::vect
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::RESOURCE_CHANGED;
     event.player_id = player_id;
-    event.data["resource_type"] = resource_type;
-    event.data["action"] = 0; // 0 = drop, 1 = take
-    event.message = "resource_dropped";
+    event.resource_type = resource_type;
+    event.action = 0; // 0 = drop, 1 = take
+    event.message = _game_state->internEventString("resource_dropped");
     
     _game_state->addEvent(event);
     logCommand("pdr", params);
 }
 
-void zappy::network::protocol::CommandParser::handleResourceTake(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleResourceTake(const TokenList& params) {
     if (!validateParameters(params, 2, "pgt")) return;
     
     // Format: pgt #n i
-    std::string player_str = params[0];
+    std::string_view player_str = params[0];
     if (player_str.empty() || player_str[0] != '#') {
-        logError("Invalid player ID format: " + player_str);
+        logError("Invalid player ID format: " + std::string(player_str));
         return;
     }
     
@@ -531,15 +637,15 @@ void zappy::network::protocol::CommandParser::handleResourceTake(const std::vect
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::RESOURCE_CHANGED;
     event.player_id = player_id;
-    event.data["resource_type"] = resource_type;
-    event.data["action"] = 1; // 0 = drop, 1 = take
-    event.message = "resource_taken";
+    event.resource_type = resource_type;
+    event.action = 1; // 0 = drop, 1 = take
+    event.message = _game_state->internEventString("resource_taken");
     
     _game_state->addEvent(event);
     logCommand("pgt", params);
 }
 
-void zappy::network::protocol::CommandParser::handleTimeUnitSet(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleTimeUnitSet(const TokenList& params) {
     if (!validateParameters(params, 1, "sst")) return;
     
     int time_unit = parseInteger(params[0], "time unit");
@@ -548,7 +654,7 @@ void zappy::network::protocol::CommandParser::handleTimeUnitSet(const std::vecto
     logCommand("sst", params);
 }
 
-void zappy::network::protocol::CommandParser::handleServerMessage(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleServerMessage(const TokenList& params) {
     if (!validateParameters(params, 1, "smg")) return;
     
     std::string message = parseString(params[0]);
@@ -558,38 +664,68 @@ void zappy::network::protocol::CommandParser::handleServerMessage(const std::vec
     zappy::game::world::GameEvent event;
     event.type = zappy::game::world::GameEvent::BROADCAST_RECEIVED;
     event.player_id = -1; // Indique que c'est un message du serveur
-    event.message = message;
+    event.text = _game_state->copyEventText(message);
     
     _game_state->addEvent(event);
     logCommand("smg", params);
 }
 
-void zappy::network::protocol::CommandParser::handleUnknownCommand(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleUnknownCommand(const TokenList& params) {
     (void)params; // Suppress unused parameter warning
     logWarning("Server reported unknown command");
 }
 
-void zappy::network::protocol::CommandParser::handleBadParameter(const std::vector<std::string>& params) {
+void zappy::network::protocol::CommandParser::handleBadParameter(const TokenList& params) {
     (void)params; // Suppress unused parameter warning
     logWarning("Server reported bad parameter");
 }
 
 // Utilitaires de parsing
 
-int zappy::network::protocol::CommandParser::parseInteger(const std::string& str, const std::string& context) const {
-    try {
-        return std::stoi(str);
-    } catch (const std::exception& e) {
-        logError("Failed to parse integer '" + str + "' for " + context);
+int zappy::network::protocol::CommandParser::parseInteger(std::string_view str, const char* context) const {
+    int value = 0;
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+
+    // Comme std::stoi, un suffixe non numérique est ignoré
+    if (result.ec != std::errc()) {
+        logError("Failed to parse integer '" + std::string(str) + "' for " + context);
         return 0;
     }
+    return value;
+}
+
+std::string zappy::network::protocol::CommandParser::parseString(std::string_view str) const {
+    return std::string(str);
+}
+
+void zappy::network::protocol::CommandParser::parseResources(const TokenList& params, size_t start_index, zappy::game::world::ZappyTile& tile) const {
+    int* fields[] = {&tile.food, &tile.linemate, &tile.deraumere, &tile.sibur,
+                     &tile.mendiane, &tile.phiras, &tile.thystame};
+
+    for (size_t i = 0; i < 7 && start_index + i < params.size(); ++i) {
+        *fields[i] = parseInteger(params[start_index + i], "resource");
+    }
 }
 
-std::string zappy::network::protocol::CommandParser::parseString(const std::string& str) const {
-    return str;
+bool zappy::network::protocol::CommandParser::parseTileLine(std::string_view text, zappy::game::world::ZappyTile& tile) {
+    int* fields[] = {&tile.x, &tile.y, &tile.food, &tile.linemate, &tile.deraumere,
+                     &tile.sibur, &tile.mendiane, &tile.phiras, &tile.thystame};
+
+    const char* p = text.data();
+    const char* end = p + text.size();
+
+    for (int* field : fields) {
+        while (p < end && *p == ' ') {
+            ++p;
+        }
+        if (!readDigits(p, end, *field)) {
+            return false;
+        }
+    }
+    return skipSeparators(text, p - text.data()) == text.size();
 }
 
-std::vector<int> zappy::network::protocol::CommandParser::parseResourceList(const std::vector<std::string>& params, size_t start_index) const {
+std::vector<int> zappy::network::protocol::CommandParser::parseResourceList(const TokenList& params, size_t start_index) const {
     std::vector<int> resources;
     
     for (size_t i = start_index; i < start_index + 7 && i < params.size(); ++i) {
@@ -599,11 +735,11 @@ std::vector<int> zappy::network::protocol::CommandParser::parseResourceList(cons
     return resources;
 }
 
-std::vector<int> zappy::network::protocol::CommandParser::parsePlayerList(const std::vector<std::string>& params, size_t start_index) const {
+std::vector<int> zappy::network::protocol::CommandParser::parsePlayerList(const TokenList& params, size_t start_index) const {
     std::vector<int> players;
     
     for (size_t i = start_index; i < params.size(); ++i) {
-        std::string player_str = params[i];
+        std::string_view player_str = params[i];
         if (!player_str.empty() && player_str[0] == '#') {
             players.push_back(parseInteger(player_str.substr(1), "player ID"));
         }
@@ -614,9 +750,9 @@ std::vector<int> zappy::network::protocol::CommandParser::parsePlayerList(const
 
 // Validation
 
-bool zappy::network::protocol::CommandParser::validateParameters(const std::vector<std::string>& params, size_t expected_count, const std::string& command) const {
+bool zappy::network::protocol::CommandParser::validateParameters(const TokenList& params, size_t expected_count, const char* command) const {
     if (params.size() < expected_count) {
-        logError("Command '" + command + "' expects " + std::to_string(expected_count) + 
+        logError("Command '" + std::string(command) + "' expects " + std::to_string(expected_count) + 
                 " parameters, got " + std::to_string(params.size()));
         return false;
     }
@@ -662,8 +798,8 @@ bool zappy::network::protocol::CommandParser::validatePlayerId(int player_id) co
 
 // Logging
 
-void zappy::network::protocol::CommandParser::logCommand(const std::string& command, const std::vector<std::string>& params) const {
-    std::ostringstream oss;
+void zappy::network::protocol::CommandParser::logCommand(std::string_view command, const TokenList& params) const {
+    //std::ostringstream oss;
     //oss << "[CommandParser] " << command;
     //for (const auto& param : params) {
     //    oss << " " << param;
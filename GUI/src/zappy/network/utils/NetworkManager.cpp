@@ -78,13 +78,17 @@ bool zappy::network::utils::NetworkManager::authenticateAsGraphic() {
 }
 
 void zappy::network::utils::NetworkManager::processPendingCommands() {
-    auto pending_commands = _game_state->getAndClearPendingCommands();
+    std::vector<zappy::game::world::NetworkCommand> pending_commands;
 
+    if (_game_state->drainPendingCommands(pending_commands) == 0) {
+        return;
+    }
     std::lock_guard<std::mutex> lock(_send_mutex);
     for (const auto& cmd : pending_commands) {
-        std::string message = cmd.command + "\n";
-        _send_queue.push(message);
-        logDebug("Queued pending command: " + cmd.command);
+        const std::string& command = _game_state->getCommandString(cmd.command);
+        _send_queue.push(command + "\n");
+        logDebug("Queued pending command: " + command);
+        _game_state->releaseCommandString(cmd.command);
     }
 }
 
@@ -212,6 +216,7 @@ void zappy::network::utils::NetworkManager::closeSocket() {
         _poll_fds[0].fd = -1;
     }
     _receive_buffer.clear();
+    _read_offset = 0;
     
     // Vider la queue d'envoi
     std::lock_guard<std::mutex> lock(_send_mutex);
@@ -251,8 +256,11 @@ bool zappy::network::utils::NetworkManager::handlePollEvents() {
 }
 
 bool zappy::network::utils::NetworkManager::receiveData() {
-    char buffer[4096];
-    ssize_t bytes_received = recv(_socket_fd, buffer, sizeof(buffer) - 1, 0);
+    // Lecture directe à la fin du buffer, sans tampon intermédiaire
+    size_t used = _receive_buffer.size();
+    _receive_buffer.resize(used + RECEIVE_CHUNK_SIZE);
+    ssize_t bytes_received = recv(_socket_fd, &_receive_buffer[used], RECEIVE_CHUNK_SIZE, 0);
+    _receive_buffer.resize(used + std::max<ssize_t>(bytes_received, 0));
     
     if (bytes_received == -1) {
         if (errno == EAGAIN || errno == EWOULDBLOCK) {
@@ -269,13 +277,11 @@ bool zappy::network::utils::NetworkManager::receiveData() {
         return false;
     }
     
-    buffer[bytes_received] = '\0';
-    _receive_buffer += buffer;
-    
     // Vérifier la taille du buffer
     if (_receive_buffer.size() > MAX_BUFFER_SIZE) {
         logError("Receive buffer overflow");
         _receive_buffer.clear();
+        _read_offset = 0;
         return false;
     }
     
@@ -311,60 +317,43 @@ bool zappy::network::utils::NetworkManager::sendPendingData() {
 }
 
 void zappy::network::utils::NetworkManager::processReceivedData() {
-    std::string message;
-    while (!(message = extractNextMessage()).empty()) {
+    std::string_view message;
+    while (extractNextMessage(message)) {
         processCompleteMessage(message);
     }
+    _command_parser->flushTileUpdates();
+    // Seule la ligne incomplète est déplacée, une fois par lot
+    _receive_buffer.erase(0, _read_offset);
+    _read_offset = 0;
 }
 
-std::string zappy::network::utils::NetworkManager::extractNextMessage() {
-    size_t newline_pos = _receive_buffer.find('\n');
+bool zappy::network::utils::NetworkManager::extractNextMessage(std::string_view& message) {
+    size_t newline_pos = _receive_buffer.find('\n', _read_offset);
     if (newline_pos == std::string::npos) {
-        return ""; // Message incomplet
+        return false; // Message incomplet
     }
     
-    std::string message = _receive_buffer.substr(0, newline_pos);
-    _receive_buffer.erase(0, newline_pos + 1);
+    // Vue valide jusqu'au prochain erase, à la fin de processReceivedData
+    message = std::string_view(_receive_buffer).substr(_read_offset, newline_pos - _read_offset);
+    _read_offset = newline_pos + 1;
     
     if (!message.empty() && message.back() == '\r') {
-        message.pop_back();
+        message.remove_suffix(1);
     }
     
-    return message;
+    return true;
 }
 
-void zappy::network::utils::NetworkManager::processCompleteMessage(const std::string& message) {
+void zappy::network::utils::NetworkManager::processCompleteMessage(std::string_view message) {
     if (message.empty()) {
         return;
     }
     
 #ifndef NDEBUG
-    logDebug("Received: " + message);
+    logDebug("Received: " + std::string(message));
 #endif
     
-    // Séparer la commande et les paramètres
-    std::vector<std::string> parts = splitMessage(message);
-    if (parts.empty()) {
-        return;
-    }
-    
-    std::string command = parts[0];
-    parts.erase(parts.begin());
-    
-    // Parser la commande
-    _command_parser->parseCommand(command, parts);
-}
-
-std::vector<std::string> zappy::network::utils::NetworkManager::splitMessage(const std::string& message) {
-    std::vector<std::string> parts;
-    std::stringstream ss(message);
-    std::string part;
-    
-    while (ss >> part) {
-        parts.push_back(part);
-    }
-    
-    return parts;
+    _command_parser->parseMessage(message);
 }
 
 void zappy::network::utils::NetworkManager::sendCommand(const std::string& command) {
@@ -158,6 +158,7 @@ bool zappy::network::utils::NetworkThread::handleNetworkEvents() {
         if (!_network_manager->processEvents()) {
             return false;
         }
+        _game_state->publishSnapshot();
 
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
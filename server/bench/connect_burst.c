@@ -0,0 +1,202 @@
+/*
+** EPITECH PROJECT, 2025
+** connect_burst.c
+** File description:
+** benchmark opening many connections at once and timing the WELCOME,
+** then optionally the team handshake
+*/
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_TIMEOUT_MS 30000
+
+typedef struct bench_conn_s {
+    struct timespec start;  // Time of the connect call
+    double welcome_ms;      // Delay until WELCOME, -1 while waiting
+    double team_ms;         // Delay from the team name to its answer
+} bench_conn_t;
+
+typedef struct bench_s {
+    struct pollfd *pfds;    // One entry per connection
+    bench_conn_t *conns;    // Timings of each connection
+    int nb;                 // Number of connections
+    const char *team;       // Team name sent after WELCOME, or NULL
+} bench_t;
+
+static double elapsed_ms(struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000.0 +
+        (now.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+static int open_connection(struct sockaddr_in *addr, bench_conn_t *conn)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &conn->start);
+    conn->welcome_ms = -1;
+    conn->team_ms = -1;
+    if (connect(fd, (struct sockaddr *)addr, sizeof(*addr)) < 0 &&
+        errno != EINPROGRESS) {
+        perror("connect");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int send_team(struct pollfd *pfd, bench_conn_t *conn,
+    const char *team)
+{
+    char line[256];
+    int len = snprintf(line, sizeof(line), "%s\n", team);
+
+    clock_gettime(CLOCK_MONOTONIC, &conn->start);
+    if (send(pfd->fd, line, len, MSG_NOSIGNAL) != len) {
+        pfd->events = 0;
+        return 1;
+    }
+    return 0;
+}
+
+static int read_reply(struct pollfd *pfd, bench_conn_t *conn,
+    const char *team)
+{
+    char buf[256];
+    ssize_t ret = recv(pfd->fd, buf, sizeof(buf), 0);
+    double *slot = (conn->welcome_ms < 0) ? &conn->welcome_ms :
+        &conn->team_ms;
+
+    if (ret < 0 && errno == EAGAIN)
+        return 0;
+    if (ret > 0 && memchr(buf, '\n', ret) == NULL)
+        return 0;
+    *slot = (ret > 0) ? elapsed_ms(&conn->start) : -2;
+    if (ret > 0 && team && slot == &conn->welcome_ms)
+        return send_team(pfd, conn, team);
+    pfd->events = 0;
+    return 1;
+}
+
+static int wait_replies(bench_t *bench)
+{
+    struct timespec start;
+    int done = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (done < bench->nb && elapsed_ms(&start) < BENCH_TIMEOUT_MS) {
+        if (poll(bench->pfds, bench->nb, 100) < 0)
+            return -1;
+        for (int i = 0; i < bench->nb; i++) {
+            if (bench->pfds[i].events &&
+                (bench->pfds[i].revents & (POLLIN | POLLHUP)))
+                done += read_reply(&bench->pfds[i], &bench->conns[i],
+                    bench->team);
+        }
+    }
+    return done;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+static int collect_delays(bench_t *bench, double *delays, bool team)
+{
+    double delay;
+    int ok = 0;
+
+    for (int i = 0; i < bench->nb; i++) {
+        delay = team ? bench->conns[i].team_ms : bench->conns[i].welcome_ms;
+        if (delay >= 0)
+            delays[ok++] = delay;
+    }
+    qsort(delays, ok, sizeof(double), compare_double);
+    return ok;
+}
+
+static void print_delays(const char *label, double *delays, int ok)
+{
+    if (ok > 0)
+        printf("%s (ms): min %.2f p50 %.2f p99 %.2f max %.2f\n", label,
+            delays[0], delays[ok / 2], delays[(ok * 99) / 100],
+            delays[ok - 1]);
+}
+
+static void print_report(bench_t *bench, double total)
+{
+    double *delays = malloc(sizeof(double) * bench->nb);
+    int ok;
+
+    if (!delays)
+        return;
+    ok = collect_delays(bench, delays, false);
+    printf("connections: %d, welcomed: %d, burst: %.2f ms\n", bench->nb,
+        ok, total);
+    print_delays("time to WELCOME", delays, ok);
+    if (bench->team) {
+        ok = collect_delays(bench, delays, true);
+        printf("team answers: %d\n", ok);
+        print_delays("team handshake", delays, ok);
+    }
+    free(delays);
+}
+
+static int run_bench(struct sockaddr_in *addr, int nb, const char *team)
+{
+    bench_t bench = {calloc(nb, sizeof(struct pollfd)),
+        calloc(nb, sizeof(bench_conn_t)), nb, team};
+    struct timespec start;
+
+    if (!bench.pfds || !bench.conns)
+        return 84;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < nb; i++) {
+        bench.pfds[i].fd = open_connection(addr, &bench.conns[i]);
+        bench.pfds[i].events = (bench.pfds[i].fd >= 0) ? POLLIN : 0;
+    }
+    wait_replies(&bench);
+    print_report(&bench, elapsed_ms(&start));
+    for (int i = 0; i < nb; i++)
+        close(bench.pfds[i].fd);
+    free(bench.pfds);
+    free(bench.conns);
+    return 0;
+}
+
+int main(int ac, char **av)
+{
+    struct sockaddr_in addr;
+    int nb = (ac > 2) ? atoi(av[2]) : 1000;
+
+    if (ac < 2 || nb <= 0) {
+        fprintf(stderr, "USAGE: %s port [connections] [team]\n", av[0]);
+        return 84;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)atoi(av[1]));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return run_bench(&addr, nb, (ac > 3) ? av[3] : NULL);
+}
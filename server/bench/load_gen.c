@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2025
+** load_gen.c
+** File description:
+** load generator keeping AI clients busy with a fixed command mix and
+** reporting how many answers the server sent per second
+*/
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#define LOAD_DEPTH 8
+#define LOAD_BUF_SIZE 65536
+
+static const char *const load_mix[] = {
+    "Forward\n", "Look\n", "Right\n", "Inventory\n", "Take food\n",
+    "Left\n", "Set food\n", "Connect_nbr\n", NULL
+};
+
+typedef struct load_client_s {
+    int fd;                     // Socket, -1 once the team refused it
+    int in_flight;              // Commands sent and not answered yet
+    int next_cmd;               // Index of the next command of the mix
+    size_t len;                 // Bytes waiting in buf
+    char buf[LOAD_BUF_SIZE];    // Received bytes not cut in lines yet
+} load_client_t;
+
+typedef struct load_s {
+    struct sockaddr_in addr;    // Address of the server
+    const char *team;           // Team joined by every client
+    load_client_t *clients;     // One entry per simulated player
+    struct pollfd *pfds;        // Poll set matching clients
+    int nb;                     // Number of clients
+    long answers;               // Answers to our commands
+    long deaths;                // Players starved and reconnected
+    long refused;               // Handshakes answered with ko
+} load_t;
+
+static double elapsed_s(struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) +
+        (now.tv_nsec - start->tv_nsec) / 1000000000.0;
+}
+
+static bool read_line(int fd, char *line, size_t size)
+{
+    size_t len = 0;
+    char c = 0;
+
+    while (len + 1 < size && recv(fd, &c, 1, 0) == 1 && c != '\n')
+        line[len++] = c;
+    line[len] = '\0';
+    return c == '\n';
+}
+
+static int open_socket(struct sockaddr_in *addr)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd < 0 || connect(fd, (struct sockaddr *)addr, sizeof(*addr)) < 0) {
+        perror("connect");
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int join_team(load_t *load)
+{
+    int fd = open_socket(&load->addr);
+    char welcome[64];
+    char line[256];
+
+    if (fd < 0)
+        return -1;
+    snprintf(line, sizeof(line), "%s\n", load->team);
+    if (!read_line(fd, welcome, sizeof(welcome)) ||
+        send(fd, line, strlen(line), MSG_NOSIGNAL) < 0 ||
+        !read_line(fd, line, sizeof(line)) || strcmp(line, "ko") == 0 ||
+        !read_line(fd, line, sizeof(line))) {
+        load->refused++;
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void connect_client(load_t *load, int i)
+{
+    load_client_t *client = &load->clients[i];
+
+    client->fd = join_team(load);
+    client->in_flight = 0;
+    client->len = 0;
+    load->pfds[i].fd = client->fd;
+    load->pfds[i].events = (client->fd >= 0) ? POLLIN : 0;
+}
+
+static void fill_pipeline(load_client_t *client)
+{
+    const char *cmd;
+
+    while (client->fd >= 0 && client->in_flight < LOAD_DEPTH) {
+        cmd = load_mix[client->next_cmd];
+        client->next_cmd = (load_mix[client->next_cmd + 1] != NULL) ?
+            client->next_cmd + 1 : 0;
+        if (send(client->fd, cmd, strlen(cmd), MSG_NOSIGNAL) < 0)
+            return;
+        client->in_flight++;
+    }
+}
+
+static bool handle_line(load_t *load, load_client_t *client, char *line)
+{
+    if (strcmp(line, "dead") == 0) {
+        load->deaths++;
+        return false;
+    }
+    if (strncmp(line, "message ", 8) == 0 || strncmp(line, "eject", 5) == 0)
+        return true;
+    load->answers++;
+    client->in_flight--;
+    return true;
+}
+
+static bool read_answers(load_t *load, load_client_t *client)
+{
+    ssize_t ret = recv(client->fd, client->buf + client->len,
+        LOAD_BUF_SIZE - client->len, 0);
+    char *start = client->buf;
+    char *end;
+
+    if (ret <= 0)
+        return false;
+    client->len += ret;
+    end = memchr(start, '\n', client->len);
+    while (end) {
+        *end = '\0';
+        if (!handle_line(load, client, start))
+            return false;
+        start = end + 1;
+        end = memchr(start, '\n', client->len - (start - client->buf));
+    }
+    client->len -= start - client->buf;
+    memmove(client->buf, start, client->len);
+    return true;
+}
+
+static void poll_clients(load_t *load)
+{
+    if (poll(load->pfds, load->nb, 100) < 0)
+        return;
+    for (int i = 0; i < load->nb; i++) {
+        if (load->clients[i].fd < 0 || load->pfds[i].revents == 0)
+            continue;
+        if (!read_answers(load, &load->clients[i])) {
+            close(load->clients[i].fd);
+            connect_client(load, i);
+        }
+        fill_pipeline(&load->clients[i]);
+    }
+}
+
+static void print_report(load_t *load, double total)
+{
+    printf("clients: %d, seconds: %.2f, answers: %ld (%.0f/s), "
+        "deaths: %ld, refused: %ld\n", load->nb, total, load->answers,
+        load->answers / total, load->deaths, load->refused);
+}
+
+static int run_load(load_t *load, double seconds)
+{
+    struct timespec start;
+
+    load->clients = calloc(load->nb, sizeof(load_client_t));
+    load->pfds = calloc(load->nb, sizeof(struct pollfd));
+    if (!load->clients || !load->pfds)
+        return 84;
+    for (int i = 0; i < load->nb; i++)
+        connect_client(load, i);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < load->nb; i++)
+        fill_pipeline(&load->clients[i]);
+    while (elapsed_s(&start) < seconds)
+        poll_clients(load);
+    print_report(load, elapsed_s(&start));
+    for (int i = 0; i < load->nb; i++)
+        close(load->clients[i].fd);
+    return 0;
+}
+
+int main(int ac, char **av)
+{
+    load_t load;
+    double seconds = (ac > 3) ? atof(av[3]) : 5.0;
+
+    memset(&load, 0, sizeof(load));
+    load.nb = (ac > 2) ? atoi(av[2]) : 100;
+    load.team = (ac > 4) ? av[4] : "load";
+    if (ac < 2 || load.nb <= 0 || seconds <= 0) {
+        fprintf(stderr, "USAGE: %s port [clients] [seconds] [team]\n",
+            av[0]);
+        return 84;
+    }
+    load.addr.sin_family = AF_INET;
+    load.addr.sin_port = htons((uint16_t)atoi(av[1]));
+    load.addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return run_load(&load, seconds);
+}
@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** admin.h
+** File description:
+** control channel of the server over a unix domain socket
+*/
+
+#ifndef ADMIN_H_
+    #define ADMIN_H_
+    #include "game_info.h"
+    #include <stdarg.h>
+    #define ADMIN_LINE_SIZE 256
+    #define ADMIN_REPLY_SIZE 8192
+    #define ADMIN_MAX_FREQ 10000
+
+typedef struct admin_conn_s {
+    int fd;                    // Admin client socket, -1 when unused
+    char in[ADMIN_LINE_SIZE];  // Bytes received and not parsed yet
+    size_t in_len;
+    char out[ADMIN_REPLY_SIZE]; // Reply being written
+    size_t out_len;
+    bool broken;               // Reply could not be sent, close the socket
+    struct pollfd *pollfd;     // Entry of the socket in serv->pollfds
+} admin_conn_t;
+
+typedef struct admin_s {
+    int fd;                    // Listening unix socket
+    char *path;                // Path of the socket, unlinked on exit
+    struct pollfd *pollfd;     // Entry of the listening socket
+    admin_conn_t conns[ADMIN_MAX_CONNS];
+} admin_t;
+
+typedef struct admin_cmd_s {
+    char *name;
+    void (*fct)(admin_conn_t *, server_t *, game_info_t *, char *);
+} admin_cmd_t;
+
+int admin_init(server_t *serv, const char *path);
+
+void admin_destroy(admin_t *admin);
+
+void admin_watch(server_t *serv);
+
+void admin_dispatch(server_t *serv, game_info_t *game_info);
+
+void admin_read(admin_conn_t *conn, server_t *serv, game_info_t *game_info);
+
+void admin_close(admin_conn_t *conn);
+
+void admin_write(admin_conn_t *conn, const char *fmt, ...);
+
+void admin_flush(admin_conn_t *conn);
+
+void admin_exec(admin_conn_t *conn, server_t *serv, game_info_t *game_info,
+    char *line);
+
+void admin_clients(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_tick(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_loop(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_lateness(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_commands(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_queues(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_resources(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_alloc(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_players(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_memory(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_freq(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_snapshot(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+void admin_help(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args);
+
+static const admin_cmd_t tab_admin_cmd[] = {
+    {"clients", admin_clients}, // Connected clients per team
+    {"tick", admin_tick}, // Achieved tick rate against freq
+    {"loop", admin_loop}, // Loop iteration time histogram
+    {"lateness", admin_lateness}, // Delay of the deadlines met
+    {"commands", admin_commands}, // Per command counts and latencies
+    {"queues", admin_queues}, // Command and outbound queue depths
+    {"resources", admin_resources}, // Resources lying on the map
+    {"alloc", admin_alloc}, // Allocator and pool statistics
+    {"players", admin_players}, // One line per alive player
+    {"memory", admin_memory}, // Heap footprint of the game
+    {"freq", admin_freq}, // Change the frequency of the game
+    {"snapshot", admin_snapshot}, // Every report at once
+    {"help", admin_help}, // List of the commands
+    {NULL, NULL}  // End of commands
+};
+
+#endif /* !ADMIN_H_ */
@@ -12,6 +12,9 @@
     #include <string.h>
     #include <stdio.h>
 
+    #define DEFAULT_BACKLOG 1024
+    #define MAX_GAMES 64
+
 typedef struct args_s {
     int port;         // Port number for the server
     int width;        // Width of the map
@@ -19,6 +22,11 @@ typedef struct args_s {
     int frequency;    // Frequency of actions
     char **team_names; // Comma-separated list of team names
     int team_count;   // Number of teams
+    int nb_threads;   // Number of map bands executed in parallel
+    int backlog;      // Length of the pending connections queue
+    int queue_depth;  // Max number of pending commands per player
+    char *admin_path; // Path of the admin unix socket, NULL if disabled
+    int nb_games;     // Independent games hosted behind the port
 } args_t;
 
 typedef struct tab_args_fct_s {
@@ -32,6 +40,11 @@ int width_parser(args_t *args, size_t ac, char **av, size_t *i);
 int team_names_parser(args_t *args, size_t ac, char **av, size_t *i);
 int team_count_parser(args_t *args, size_t ac, char **av, size_t *i);
 int frequency_parser(args_t *args, size_t ac, char **av, size_t *i);
+int threads_parser(args_t *args, size_t ac, char **av, size_t *i);
+int backlog_parser(args_t *args, size_t ac, char **av, size_t *i);
+int queue_depth_parser(args_t *args, size_t ac, char **av, size_t *i);
+int admin_parser(args_t *args, size_t ac, char **av, size_t *i);
+int games_parser(args_t *args, size_t ac, char **av, size_t *i);
 
 static const tab_args_fct_t tab_arg[] = {
     {"-p", *port_parser}, // Port
@@ -40,6 +53,11 @@ static const tab_args_fct_t tab_arg[] = {
     {"-f", *frequency_parser}, // Frequency
     {"-n", *team_names_parser}, // Team names
     {"-c", *team_count_parser}, // Team count
+    {"-t", *threads_parser}, // Tick worker threads
+    {"-b", *backlog_parser}, // Listen backlog
+    {"-q", *queue_depth_parser}, // Command queue depth
+    {"-a", *admin_parser}, // Admin socket path
+    {"-g", *games_parser}, // Number of games
     {NULL, NULL}  // End of table
 };
 
@@ -10,25 +10,32 @@
     #include "player.h"
     #include "game_info.h"
     #include "socket.h"
+    #include "tick_pool.h"
     #include <stdbool.h>
     #define MAX_RESPONSE_SIZE 16384
-    #define MAX_TILE_CONTENT 2048
+    #define LOOK_MAX_LEVEL 8
+    #define LOOK_MAX_TILES ((LOOK_MAX_LEVEL + 1) * (LOOK_MAX_LEVEL + 1))
     #define MAX_SINGLE_OBJECT 64
 
-static const command_ai_t tab_command_ai[] = {
-    {"Forward", 7, NULL},
-    {"Right", 7, NULL},
-    {"Left", 7, NULL},
-    {"Look", 7, NULL},
-    {"Inventory", 1, NULL},
-    {"Broadcast", 7, NULL},
-    {"Connect_nbr", 1, NULL},
-    {"Fork", 42, NULL},
-    {"Eject", 7, NULL},
-    {"Take", 7, NULL},
-    {"Set", 7, NULL},
-    {"Incantation", 300, NULL},
-    {NULL, 0, NULL}
+typedef struct command_ai_info_s {
+    char *name;                // Command name
+    int time;                  // Time required to execute the command
+} command_ai_info_t;
+
+static const command_ai_info_t tab_command_ai[] = {
+    {"Forward", 7},
+    {"Right", 7},
+    {"Left", 7},
+    {"Look", 7},
+    {"Inventory", 1},
+    {"Broadcast", 7},
+    {"Connect_nbr", 1},
+    {"Fork", 42},
+    {"Eject", 7},
+    {"Take", 7},
+    {"Set", 7},
+    {"Incantation", 300},
+    {NULL, 0}
 };
 
 static const command_gui_t tab_command_gui[] = {
@@ -76,9 +83,11 @@ void nb_unuse_slot(game_info_t *game_info, linked_client_t *player,
 void incantation(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args);
 
-void send_lvlup_finish_gui(server_t *serv, player_t *player);
+void send_lvlup_finish_gui(server_t *serv, coords_t coords);
 
-void send_lvlup_failed_gui(server_t *serv, player_t *player);
+void send_lvlup_failed_gui(server_t *serv, coords_t coords);
+
+void finish_player_command(linked_client_t *player);
 
 void fork_player(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args);
@@ -91,8 +100,6 @@ bool has_players_to_eject(game_info_t *game_info, linked_client_t *ejector,
 
 void eject_responce_gui(server_t *serv, linked_client_t *player);
 
-bool team_has_ejectables(linked_teams_t *team, linked_client_t *ejector);
-
 void drop(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args);
 
@@ -121,6 +128,27 @@ static const exec_cmd_ai_t tab_exec_ai[] = {
     {NULL, NULL}
 };
 
+typedef struct phase_cmd_ai_s {
+    exec_phase_t phase;        // Phase the command runs in
+    bool moves;                // Local only while the player stays in band
+} phase_cmd_ai_t;
+
+static const phase_cmd_ai_t tab_phase_ai[] = {
+    {PHASE_LOCAL, true},       // Forward
+    {PHASE_LOCAL, false},      // Right
+    {PHASE_LOCAL, false},      // Left
+    {PHASE_READ, false},       // Look
+    {PHASE_READ, false},       // Inventory
+    {PHASE_SERIAL, false},     // Broadcast
+    {PHASE_READ, false},       // Connect_nbr
+    {PHASE_SERIAL, false},     // Fork
+    {PHASE_SERIAL, false},     // Eject
+    {PHASE_LOCAL, false},      // Take
+    {PHASE_LOCAL, false},      // Set
+    {PHASE_SERIAL, false},     // Incantation
+    {PHASE_SERIAL, false}
+};
+
 typedef struct exec_cmd_gui_s {
     char *name;
     void (*exec_fct)(game_info_t *, server_t *, char **);
@@ -157,28 +185,22 @@ static const exec_cmd_gui_t tab_exec_gui[] = {
 };
 
 typedef struct look_coords_s {
-    int fx;
+    int fx;                    // Forward vector of the direction
     int fy;
-    int rx;
+    int rx;                    // Right hand vector of the direction
     int ry;
-    int relative_x;
-    int relative_y;
 } look_coords_t;
 
-typedef struct tdg_s {
-    coords_t target;
-    int direction;
-    game_info_t *game_info;
-} tdg_t;
-
-void get_tile_coords(player_t *player, int line, int pos,
-    coords_t *coords);
+typedef struct look_offset_s {
+    int x;                     // Offset of a seen tile from the player
+    int y;
+} look_offset_t;
 
 coords_t get_ejection_target(coords_t current, direction_t dir);
 
 int get_ejection_direction(player_t *ejector, player_t *ejected);
 
-void move_ejected_player(player_t *player, coords_t target,
+void move_ejected_player(linked_client_t *client, coords_t target,
     game_info_t *game_info);
 
 void parse_line_command(linked_client_t *client, char *command_line);
@@ -186,25 +208,18 @@ void parse_line_command(linked_client_t *client, char *command_line);
 int get_direction_number(coords_t from, coords_t to,
     direction_t receiver_direction, game_info_t *game_info);
 
-int calculate_total_tiles(int vision_range);
+void init_look_offsets(void);
+
+const look_coords_t *get_direction_frame(direction_t direction);
 
-int add_tile_to_response_secure(char *response, char *tile_content);
+const look_offset_t *get_look_offsets(direction_t direction);
 
-int get_tile_content_secure(game_info_t *game_info, server_t *serv,
-    coords_t *coords, char *content);
+int get_look_tiles(int level);
 
-int safe_strcat(char *dest, const char *src, size_t dest_size);
+int wrap_coord(int value, int size);
 
-typedef struct look_utils_s {
-    int line;
-    char *response;
-    int *pos;
-} look_utils_t;
+int append_look(look_cache_t *cache, const char *str, size_t len);
 
-typedef struct look_utils_bis_s {
-    int line;
-    int side;
-    char *response;
-} look_utils_bis_t;
+int append_look_tile(look_cache_t *cache, map_t *map, coords_t coords);
 
 #endif /* !COMMANDS_H_ */
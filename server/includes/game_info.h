@@ -14,6 +14,7 @@
     #include <string.h>
     #include <stdlib.h>
     #include <time.h>
+    #define MAX_WAIT_US 1000000
 
 typedef struct game_info_s {
     int freq;                  // Frequency of game ticks
@@ -23,10 +24,24 @@ typedef struct game_info_s {
     map_t map;                 // Game map structure
     inventory_t global_inv;    // Global inventory for the game
     struct timespec time_gen;         // Time for resource generation
+    linked_client_t **dead;    // Players starved since the last manage_death
+    size_t nb_dead;
+    size_t cap_dead;
+    struct incantation_s **rituals; // Min heap of rituals by end time
+    size_t nb_rituals;
+    size_t cap_rituals;
+    double wake_at;            // Earliest deadline, timeout of the next wait
 } game_info_t;
 
 void init_players(game_info_t *game_info);
 
+void plan_wakeup_at(game_info_t *game_info, double when);
+
+void plan_wakeup(game_info_t *game_info, struct timespec *start,
+    double delay);
+
+long next_wait_timeout(game_info_t *game_info);
+
 game_info_t *initialize_game_info(args_t *args);
 
 void generate_res_map(game_info_t *game_info);
@@ -49,36 +64,37 @@ linked_teams_t *get_team(server_t *serv, const char *team_name);
 
 bool is_valid_team(server_t *serv, const char *team_name);
 
-char *get_client_message(linked_client_t *client);
+bool receive_waiting_input(client_t *client);
 
-void setup_player_position(player_t *player, game_info_t *game_info);
+int get_client_message(client_t *client, char *dest, size_t size);
 
-bool is_client_disconnected(linked_client_t *client);
+void setup_player_position(linked_client_t *slot, game_info_t *game_info);
 
-void handle_disconnected_client(server_t *serv, linked_client_t *client);
+void handle_disconnected_client(client_t *client);
 
-bool assign_graphic_client(server_t *serv, linked_client_t *client);
+bool assign_graphic_client(server_t *serv, client_t *client);
 
-void process_waiting_client(server_t *serv, linked_client_t *client,
+bool process_waiting_client(server_t *serv, client_t *client,
     game_info_t *game_info);
 
 void assign_client_to_slot(linked_client_t *slot,
-    linked_client_t *waiting_client, game_info_t *game_info);
+    client_t *waiting_client, game_info_t *game_info);
 
 void new_connection_player_gui(player_t *player, server_t *serv);
 
 void send_connection_response(int fd, bool success, int remaining_slots,
     player_t *player);
 
-void remove_client_from_list(linked_teams_t *waiting,
-    linked_client_t *target, linked_client_t *prev);
+bool add_waiting_client(server_t *serv, client_t *client);
 
-void process_all_waiting_clients(server_t *serv, game_info_t *game_info);
-
-linked_client_t *find_free_slot(linked_teams_t *team);
+void process_ready_waiting_clients(server_t *serv, game_info_t *game_info);
 
 void verif_regen_ressources(game_info_t *game_info);
 
 void eat_food(linked_client_t *player, game_info_t *game_info);
 
+void push_dead_player(game_info_t *game_info, linked_client_t *player);
+
+void announce_winners(server_t *serv);
+
 #endif /* !GAME_INFO_H_ */
@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** games.h
+** File description:
+** several independent games hosted by one process behind a single port
+*/
+
+#ifndef GAMES_H_
+    #define GAMES_H_
+    #include "game_info.h"
+    #include "socket.h"
+    #include "metrics.h"
+    #include <pthread.h>
+    #include <stdbool.h>
+    #define ROUTER_MAX_PENDING 256
+    #define ROUTER_LINE_SIZE 256
+    #define ROUTER_WAIT_MS 1000
+    #define ROUTER_HANDSHAKE_MS 10000
+
+typedef struct game_handoff_s {
+    int fd;                    // Socket accepted by the router
+    struct sockaddr_in addr;
+    char line[ROUTER_LINE_SIZE]; // Bytes read while looking for the game
+    size_t len;
+    struct timespec accepted;  // The team line is due before the timeout
+} game_handoff_t;
+
+typedef struct game_inbox_s {
+    pthread_mutex_t lock;
+    int event_fd;              // Readable while handoffs are waiting
+    game_handoff_t *items;     // Sockets routed to the game, not adopted yet
+    size_t nb_items;
+    size_t cap_items;
+} game_inbox_t;
+
+typedef struct game_s {
+    int id;                    // Index given by the clients after the '@'
+    game_info_t *game_info;
+    server_t *serv;
+    server_metrics_t metrics;  // Counters of this game only
+    pthread_t thread;
+    bool started;              // Thread created, must be joined
+    bool finished;             // Loop left, the router stops routing to it
+} game_t;
+
+typedef struct router_s {
+    int listen_fd;             // Port shared by every game
+    struct pollfd pfds[ROUTER_MAX_PENDING + 1]; // Listener then handshakes
+    game_handoff_t pending[ROUTER_MAX_PENDING + 1]; // Same index as pfds
+    int nb_pending;
+    game_t *games;
+    int nb_games;
+} router_t;
+
+int host_games(args_t *args);
+
+void run_router(router_t *router);
+
+game_inbox_t *create_game_inbox(void);
+
+void destroy_game_inbox(game_inbox_t *inbox);
+
+bool push_game_inbox(game_inbox_t *inbox, const game_handoff_t *handoff);
+
+bool pop_game_inbox(game_inbox_t *inbox, game_handoff_t *handoff);
+
+size_t game_memory_footprint(server_t *serv, game_info_t *game_info);
+
+#endif /* !GAMES_H_ */
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** incantation.h
+** File description:
+** header of the rituals started by Incantation and of their scheduler
+*/
+
+#ifndef INCANTATION_H_
+    #define INCANTATION_H_
+    #include "game_info.h"
+    #include "socket.h"
+
+typedef struct incantation_s {
+    coords_t coords;           // Tile of the ritual
+    int level;                 // Level of the participants
+    double end_time;           // Absolute completion time in seconds
+    linked_client_t *leader;   // Player that started it, NULL once gone
+    linked_client_t **members; // Participants, NULL once they left
+    size_t nb_members;
+    size_t cap_members;
+} incantation_t;
+
+double get_time_seconds(void);
+
+incantation_t *create_incantation(map_t *map, linked_client_t *leader);
+
+void destroy_incantation(incantation_t *ritual);
+
+void schedule_incantation(game_info_t *game_info, incantation_t *ritual);
+
+void resolve_incantations(server_t *serv, game_info_t *game_info);
+
+void destroy_incantations(game_info_t *game_info);
+
+bool is_valid_member(incantation_t *ritual, linked_client_t *member);
+
+bool can_elevate(game_info_t *game_info, incantation_t *ritual);
+
+void consume_elevation_resources(game_info_t *game_info,
+    coords_t coords, int level);
+
+void finish_incantation(server_t *serv, game_info_t *game_info,
+    incantation_t *ritual);
+
+#endif /* !INCANTATION_H_ */
@@ -8,11 +8,26 @@
 #ifndef MAP_H_
     #define MAP_H_
     #include "ressources.h"
+    #include "player.h"
 
 typedef struct map_s {
-    inventory_t **block;
+    inventory_t **block;       // Content of the tiles, [y][x]
     int width;
     int height;
+    int *nb_players;           // Alive players of each tile, [y * width + x]
+    unsigned long *version;    // Bumped on each change of a tile, same index
+    struct linked_client_s **eggs; // Eggs laid on each tile, same index
+    struct linked_client_s **players; // Alive players of each tile, by id
 } map_t;
 
+int tile_index(map_t *map, coords_t coords);
+
+void touch_tile(map_t *map, coords_t coords);
+
+void enter_tile(map_t *map, struct linked_client_s *client);
+
+void leave_tile(map_t *map, struct linked_client_s *client);
+
+struct linked_client_s *get_tile_players(map_t *map, coords_t coords);
+
 #endif /* !MAP_H_ */
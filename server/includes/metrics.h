@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** metrics.h
+** File description:
+** counters kept by the server while it runs
+*/
+
+#ifndef METRICS_H_
+    #define METRICS_H_
+    #include <time.h>
+    #define METRICS_NB_CMDS 16
+    #define METRICS_NB_BUCKETS 14
+    #define METRICS_FIRST_BUCKET_US 16
+
+typedef struct server_metrics_s {
+    unsigned long cmd_enqueued;   // AI commands accepted in a queue
+    unsigned long cmd_overflows;  // AI commands dropped, queue was full
+    unsigned long cmd_count[METRICS_NB_CMDS]; // Runs per tab_command_ai index
+    unsigned long cmd_ns[METRICS_NB_CMDS];    // Time spent in each command
+    double ticks_done;            // Ticks of the commands that completed
+    double ticks_time;            // Seconds their players really waited
+    unsigned long loops;          // Iterations of the server loop
+    unsigned long loop_max_us;    // Slowest iteration, poll wait excluded
+    unsigned long loop_hist[METRICS_NB_BUCKETS]; // Iterations per duration
+    unsigned long late_count;     // Deadlines met, commands and rituals
+    unsigned long late_total_us;  // Sum of the delays past the deadlines
+    unsigned long late_max_us;    // Worst delay past a deadline
+    unsigned long late_hist[METRICS_NB_BUCKETS]; // Deadlines per delay
+    struct timespec start;        // Start of the server loop
+} server_metrics_t;
+
+server_metrics_t *get_server_metrics(void);
+
+void set_server_metrics(server_metrics_t *metrics);
+
+unsigned long elapsed_us(const struct timespec *start);
+
+void record_loop_time(const struct timespec *start);
+
+void record_command(int index, const struct timespec *start);
+
+void record_command_wait(int ticks, double seconds);
+
+void record_lateness(double seconds);
+
+void print_server_metrics(void);
+
+#endif /* !METRICS_H_ */
@@ -0,0 +1,34 @@
+/*
+** EPITECH PROJECT, 2025
+** net_backend.h
+** File description:
+** socket I/O used by the server loop, backed by poll or io_uring
+*/
+
+#ifndef NET_BACKEND_H_
+    #define NET_BACKEND_H_
+    #include "socket.h"
+    #include <stdbool.h>
+    #include <sys/types.h>
+
+int net_backend_init(server_t *serv);
+
+void net_backend_destroy(void);
+
+int net_wait(server_t *serv, long timeout_us);
+
+void net_watch(server_t *serv, int slot);
+
+void net_flush(void);
+
+ssize_t net_recv(int fd, void *buf, size_t len);
+
+bool net_peer_closed(int fd);
+
+void net_send(int fd, const char *buf, size_t len);
+
+void net_close(int fd);
+
+size_t net_pending(int fd);
+
+#endif /* !NET_BACKEND_H_ */
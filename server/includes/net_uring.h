@@ -0,0 +1,119 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring.h
+** File description:
+** internal state of the io_uring backend of the server loop
+*/
+
+#ifndef NET_URING_H_
+    #define NET_URING_H_
+    #include "net_backend.h"
+    #include <linux/io_uring.h>
+    #include <pthread.h>
+    #include <stdint.h>
+    #define NET_SQ_ENTRIES 4096
+    #define NET_CQ_ENTRIES 16384
+    #define NET_NB_BUFS 512
+    #define NET_BUF_SIZE CIRCBUF_SIZE
+    #define NET_BGID 1
+    #define NET_MAX_FD 65536
+    #define NET_CLOSE_TRIES 20
+    #define NET_OP_SHIFT 56
+    #define NET_GEN_SHIFT 32
+
+typedef enum net_op_e {
+    NET_OP_ACCEPT = 1,         // Multishot poll on the listening socket
+    NET_OP_RECV,               // Multishot recv with provided buffers
+    NET_OP_SEND,               // One flush of the outbound buffer
+    NET_OP_CANCEL,             // Cancelation of the requests of a socket
+    NET_OP_POLL                // One-shot poll on a socket read directly
+} net_op_t;
+
+typedef struct net_buf_s {
+    char *data;
+    size_t len;
+    size_t cap;
+} net_buf_t;
+
+typedef struct net_conn_s {
+    net_buf_t in;              // Bytes received and not read yet
+    net_buf_t out;             // Bytes waiting for the next flush
+    net_buf_t inflight;        // Bytes owned by the kernel until completion
+    int slot;                  // Index of the socket in serv->pollfds
+    bool eof;                  // Peer closed the socket or recv failed
+    bool armed;                // A multishot recv is posted
+    bool sending;              // A send is posted
+    bool dirty;                // Already in the flush list
+} net_conn_t;
+
+typedef struct net_uring_s {
+    int ring_fd;
+    void *sq_map;
+    size_t sq_map_size;
+    void *cq_map;
+    size_t cq_map_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_array;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    unsigned sq_local_tail;    // Tail of the SQEs filled but not submitted
+    unsigned to_submit;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    struct io_uring_buf_ring *buf_ring;
+    char *buf_pool;
+    net_conn_t *conns[NET_MAX_FD];
+    uint32_t gen[NET_MAX_FD];  // Bumped on close to drop stale completions
+    int dirty[NET_MAX_FD];     // Sockets with bytes to flush
+    int nb_dirty;
+    bool polled[NET_MAX_FD];   // A NET_OP_POLL is posted on the socket
+    bool accept_armed;
+    server_t *serv;
+    pthread_mutex_t send_lock;
+} net_uring_t;
+
+net_uring_t *get_net_uring(void);
+
+int net_uring_setup(net_uring_t *ring);
+
+void net_uring_teardown(net_uring_t *ring);
+
+struct io_uring_sqe *net_uring_get_sqe(net_uring_t *ring);
+
+int net_uring_enter(net_uring_t *ring, unsigned min_complete,
+    long timeout_us);
+
+void net_uring_reap(net_uring_t *ring);
+
+void net_uring_recycle(net_uring_t *ring, unsigned short bid);
+
+uint64_t net_uring_data(net_uring_t *ring, net_op_t op, int fd);
+
+void net_uring_handle_cqe(net_uring_t *ring, struct io_uring_cqe *cqe);
+
+void net_uring_arm_accept(net_uring_t *ring);
+
+void net_uring_arm_recv(net_uring_t *ring, int fd);
+
+void net_uring_post_send(net_uring_t *ring, int fd, net_conn_t *conn);
+
+bool net_buf_append(net_buf_t *buf, const char *data, size_t len);
+
+void net_buf_consume(net_buf_t *buf, size_t len);
+
+void net_buf_free(net_buf_t *buf);
+
+void net_uring_arm_polls(net_uring_t *ring, server_t *serv);
+
+void net_uring_handle_poll(net_uring_t *ring, int fd, int res);
+
+void net_uring_cancel_poll(net_uring_t *ring, int fd);
+
+void net_uring_mark_dirty(net_uring_t *ring, int fd, net_conn_t *conn);
+
+#endif /* !NET_URING_H_ */
@@ -16,16 +16,25 @@ typedef struct coords_s {
     int y;
 } coords_t;
 
+    #define CMD_ARGS_SIZE 240
+    #define DEFAULT_QUEUE_DEPTH 10
+    #define MAX_QUEUE_DEPTH 1024
+
 typedef struct command_ai_s {
-    char *name;                // Command name
-    int time;                // Time required to execute the command
-    char *args;
+    const char *name;          // Command name, points into tab_command_ai
+    int index;                 // Index of the command in tab_command_ai
+    int time;                  // Time required to execute the command
+    char args[CMD_ARGS_SIZE];  // Argument of the command, empty if none
+    char *long_args;           // Heap copy of a longer argument, else NULL
 } command_ai_t;
 
 typedef struct queue_command_ai_s {
-    command_ai_t command[10]; // Array of commands
-    int front;                // Index of the front command
-    int rear;                 // Index of the rear command
+    command_ai_t *command;     // Ring of records, power of two sized
+    unsigned int mask;         // Ring size minus one
+    unsigned int depth;        // Max number of queued commands
+    unsigned int front;        // Free running index of the front command
+    unsigned int rear;         // Free running index after the last command
+    unsigned long overflows;   // Commands dropped because the queue was full
 } queue_command_ai_t;
 
 typedef enum direction_s {
@@ -42,6 +51,16 @@ typedef enum state_s {
     EGG
 } state_t;
 
+typedef struct look_cache_s {
+    char *response;            // Last Look answer, NULL before the first one
+    size_t len;                // Length of the answer
+    size_t cap;                // Allocated size of the answer
+    coords_t coords;           // Position the answer was built from
+    direction_t direction;     // Direction the answer was built from
+    int level;                 // Level the answer was built from
+    unsigned long sum;         // Sum of the versions of the seen tiles
+} look_cache_t;
+
 typedef struct player_s {
     int id;                    // Player ID
     char *team_name;           // Team name of the player
@@ -56,6 +75,14 @@ typedef struct player_s {
     bool was_a_egg;            // If the player was an egg
     bool is_incantation;      // If the player is in incantation
     queue_command_ai_t *command;
+    struct linked_teams_s *team; // Team owning the player slot
+    struct incantation_s *ritual; // Ritual the player takes part in
+    look_cache_t look;         // Answer of the last Look of the player
+    int slot_index;            // Position in the egg or unused slot stack
+    struct linked_client_s *egg_next; // Next egg laid on the same tile
+    struct linked_client_s *egg_prev; // Previous egg laid on the same tile
+    struct linked_client_s *tile_next; // Next alive player on the same tile
+    struct linked_client_s *tile_prev; // Previous alive player on the tile
 } player_t;
 
 typedef struct command_gui_s {
@@ -89,10 +116,18 @@ command_ai_t *peek(queue_command_ai_t *q);
 
 void dequeue(queue_command_ai_t *q);
 
-void enqueue(queue_command_ai_t *q, command_ai_t value);
+command_ai_t *enqueue(queue_command_ai_t *q);
+
+char *get_command_args(command_ai_t *cmd);
 
 void initialize_queue_ai(queue_command_ai_t *q);
 
+void set_queue_ai_depth(int depth);
+
+queue_command_ai_t *create_queue_ai(void);
+
+void destroy_queue_ai(queue_command_ai_t *q);
+
 void get_current_time(struct timespec *ts);
 
 typedef struct linked_player_s {
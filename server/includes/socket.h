@@ -18,8 +18,11 @@
     #include <string.h>
     #include <unistd.h>
 
-    #define BACKLOG 10
-    #define MAX_CLIENTS 1000
+    #define MAX_CLIENTS 2048
+    #define ADMIN_MAX_CONNS 8
+    // Admin listening socket then its connections, after the client slots
+    #define ADMIN_POLLFD (MAX_CLIENTS + 1)
+    #define NB_POLLFDS (ADMIN_POLLFD + 1 + ADMIN_MAX_CONNS)
     #define CIRCBUF_SIZE 4096
 
 typedef struct circbuf_s {
@@ -40,12 +43,22 @@ typedef struct linked_client_s {
     client_t *client;
     player_t *player;
     struct linked_client_s *next;
+    struct linked_client_s *prev; // Unlinks from the team in O(1)
     bool after_connect;
 } linked_client_t;
 
+typedef struct slot_stack_s {
+    linked_client_t **items;
+    size_t nb;
+    size_t cap;
+} slot_stack_t;
+
 typedef struct linked_teams_s {
     char *name_team;
     int nbr_max_player;
+    int nb_max_level;          // Players of the team at level 8
+    slot_stack_t eggs;         // Eggs waiting for a client
+    slot_stack_t unused;       // Slots free since the start or a departure
     linked_client_t *head_client;
     struct linked_teams_s *next;
 } linked_teams_t;
@@ -53,6 +66,7 @@ typedef struct linked_teams_s {
 typedef struct socket_s {
     int port;
     int socket_fd;
+    int backlog;
     struct sockaddr_in server_adr;
     bool disconect;
 } socket_t;
@@ -67,8 +81,21 @@ typedef struct server_s {
     socket_t sock;
     linked_teams_t *head_team;
     gui_t *gui_client;
-    struct pollfd pollfds[MAX_CLIENTS + 1];
+    struct pollfd pollfds[NB_POLLFDS];
     int nb_clients;
+    int free_slots[MAX_CLIENTS];  // Stack of the unused pollfds indexes
+    int nb_free_slots;
+    int nb_winning_teams;      // Teams with at least one level 8 player
+    struct tick_pool_s *pool;  // Threads executing completed commands
+    struct map_s *map;         // Map of the game, to free the tile on leave
+    struct admin_s *admin;     // Unix socket control channel, NULL if off
+    struct game_inbox_s *inbox; // Sockets routed by the shared listener
+    client_t *waiting[MAX_CLIENTS + 1]; // By pollfds slot, until the team
+    size_t nb_waiting;
+    int ready_slots[NB_POLLFDS]; // pollfds indexes with revents this loop
+    int nb_ready;
+    linked_teams_t **team_table; // Teams by hash of their name
+    unsigned int team_mask;    // Size of the team table minus one
 } server_t;
 
 extern bool exit_server;
@@ -85,9 +112,32 @@ void handle_gui_message(server_t *serv, gui_t *gui);
 
 void init_linked_teams(args_t *args, linked_teams_t **head_team, int *id);
 
+int build_team_table(server_t *serv);
+
 void send_responce(int fd, char *str);
 
 void parse_client_command(server_t *serv, linked_client_t *client);
+void parse_gui_command(server_t *serv, gui_t *client);
+
+void init_pollfd_slots(server_t *serv);
+
+int acquire_pollfd_slot(server_t *serv);
+
+void release_pollfd(struct pollfd *pollfd);
+
+void collect_ready_slots(server_t *serv, int ready);
+
+void add_ready_slot(server_t *serv, int slot);
+
+void add_max_level_player(server_t *serv, player_t *player);
+
+void remove_max_level_player(server_t *serv, player_t *player);
+
+void detach_from_incantation(linked_client_t *client);
+
+void add_client_to_team(linked_teams_t *team, linked_client_t *node);
+
+void remove_client_from_team(linked_teams_t *team, linked_client_t *target);
 
 char **my_str_to_word_array(char *str, char *separator);
 
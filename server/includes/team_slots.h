@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** team_slots.h
+** File description:
+** stacks of the eggs and unused slots of a team, eggs indexed by tile
+*/
+
+#ifndef TEAM_SLOTS_H_
+    #define TEAM_SLOTS_H_
+    #include "socket.h"
+    #include "map.h"
+
+void add_unused_slot(linked_teams_t *team, linked_client_t *slot);
+
+void add_egg(linked_teams_t *team, linked_client_t *egg, map_t *map);
+
+void remove_egg(linked_teams_t *team, linked_client_t *egg, map_t *map);
+
+linked_client_t *take_team_slot(linked_teams_t *team, map_t *map);
+
+int count_team_slots(linked_teams_t *team);
+
+linked_client_t *get_tile_eggs(map_t *map, coords_t coords);
+
+#endif /* !TEAM_SLOTS_H_ */
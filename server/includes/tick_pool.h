@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** tick_pool.h
+** File description:
+** worker pool that executes completed commands by horizontal map bands
+*/
+
+#ifndef TICK_POOL_H_
+    #define TICK_POOL_H_
+    #include "game_info.h"
+    #include "socket.h"
+    #include "metrics.h"
+    #include <pthread.h>
+    #include <stdbool.h>
+    #define MAX_TICK_THREADS 64
+
+typedef enum exec_phase_e {
+    PHASE_READ,                // Read only commands, run on every band
+    PHASE_LOCAL,               // Commands that only touch their own band
+    PHASE_SERIAL               // Cross band or global commands, list order
+} exec_phase_t;
+
+typedef struct ready_cmd_s {
+    linked_client_t *client;   // Client whose front command is complete
+    command_ai_t *cmd;         // Command to execute
+    int band;                  // Band of the player tile, nb_bands to cross
+    exec_phase_t phase;        // Phase in which the command must run
+    size_t gui_start;          // GUI lines of the command in its band buffer
+    size_t gui_len;
+} ready_cmd_t;
+
+typedef struct gui_out_s {
+    char *data;                // GUI lines written during a parallel phase
+    size_t len;
+    size_t cap;
+} gui_out_t;
+
+typedef struct tick_worker_s {
+    struct tick_pool_s *pool;  // Pool the worker belongs to
+    int band;                  // Band executed by this worker
+} tick_worker_t;
+
+typedef struct tick_pool_s {
+    pthread_t threads[MAX_TICK_THREADS];
+    tick_worker_t workers[MAX_TICK_THREADS];
+    int nb_bands;              // Number of bands, band 0 runs on main thread
+    ready_cmd_t *ready;        // Commands completed during this loop
+    size_t nb_ready;
+    size_t cap_ready;
+    size_t nb_phase[PHASE_SERIAL + 1]; // Number of ready commands per phase
+    pthread_mutex_t lock;
+    pthread_cond_t start_cond;
+    pthread_cond_t done_cond;
+    unsigned long generation;  // Bumped each time a phase is dispatched
+    int running;               // Workers still busy on the current phase
+    bool stop;
+    exec_phase_t phase;        // Phase being executed
+    game_info_t *game_info;
+    server_t *serv;
+    server_metrics_t *metrics; // Counters of the game owning the pool
+    gui_out_t gui_out[MAX_TICK_THREADS + 1]; // GUI lines of each band
+    gui_out_t gui_flush;       // GUI lines of a phase put back in list order
+} tick_pool_t;
+
+tick_pool_t *create_tick_pool(int nb_bands);
+
+void destroy_tick_pool(tick_pool_t *pool);
+
+void run_tick_phase(tick_pool_t *pool, exec_phase_t phase);
+
+void run_band_commands(tick_pool_t *pool, int band);
+
+int get_band_of_row(int y, int height, int nb_bands);
+
+void push_ready_command(tick_pool_t *pool, linked_client_t *client,
+    command_ai_t *cmd, game_info_t *game_info);
+
+void execute_ready_commands(server_t *serv, game_info_t *game_info);
+
+void run_ready_command(linked_client_t *player, game_info_t *game_info,
+    command_ai_t *cmd, server_t *serv);
+
+void set_tick_gui_out(gui_out_t *out);
+
+void send_gui_message(server_t *serv, const char *msg, size_t len);
+
+void flush_tick_gui_out(tick_pool_t *pool);
+
+#endif /* !TICK_POOL_H_ */
@@ -26,6 +26,8 @@ void destroy_teams(linked_teams_t *head_team);
 
 void destroy_gui(gui_t *gui);
 
+void destroy_waiting_clients(server_t *serv);
+
 void destroy_game_info(game_info_t *game_info);
 
 #endif /* !ZAPPY_H_ */
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** admin.c
+** File description:
+** unix socket of the control channel, watched by the wait of the loop
+*/
+
+#define _GNU_SOURCE
+#include "admin.h"
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+static void unlink_stale_socket(const char *path)
+{
+    struct stat st;
+
+    if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+}
+
+static int bind_admin_socket(admin_t *admin)
+{
+    struct sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(admin->path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Error: admin socket path is too long.\n");
+        return 84;
+    }
+    strcpy(addr.sun_path, admin->path);
+    unlink_stale_socket(admin->path);
+    if (bind(admin->fd, (const struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 84;
+    }
+    if (listen(admin->fd, ADMIN_MAX_CONNS) < 0) {
+        perror("listen");
+        unlink(admin->path);
+        return 84;
+    }
+    return 0;
+}
+
+int admin_init(server_t *serv, const char *path)
+{
+    admin_t *admin = calloc(1, sizeof(admin_t));
+
+    if (!admin) {
+        perror("calloc");
+        return 84;
+    }
+    for (int i = 0; i < ADMIN_MAX_CONNS; i++)
+        admin->conns[i].fd = -1;
+    admin->path = strdup(path);
+    admin->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (admin->fd < 0 || !admin->path || bind_admin_socket(admin) != 0) {
+        if (admin->fd >= 0)
+            close(admin->fd);
+        free(admin->path);
+        free(admin);
+        return 84;
+    }
+    serv->admin = admin;
+    printf("Admin socket listening on %s\n", path);
+    return 0;
+}
+
+void admin_destroy(admin_t *admin)
+{
+    if (!admin)
+        return;
+    for (int i = 0; i < ADMIN_MAX_CONNS; i++)
+        admin_close(&admin->conns[i]);
+    close(admin->fd);
+    unlink(admin->path);
+    free(admin->path);
+    free(admin);
+}
+
+void admin_watch(server_t *serv)
+{
+    struct pollfd *pfds = &serv->pollfds[ADMIN_POLLFD];
+    admin_t *admin = serv->admin;
+
+    for (int i = 0; i <= ADMIN_MAX_CONNS; i++)
+        pfds[i] = (struct pollfd){-1, 0, 0};
+    if (!admin)
+        return;
+    pfds[0] = (struct pollfd){admin->fd, POLLIN, 0};
+    admin->pollfd = &pfds[0];
+    for (int i = 0; i < ADMIN_MAX_CONNS; i++)
+        admin->conns[i].pollfd = &pfds[i + 1];
+}
+
+static void accept_admin_conns(admin_t *admin)
+{
+    int fd = accept4(admin->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    int slot;
+
+    while (fd >= 0) {
+        slot = 0;
+        while (slot < ADMIN_MAX_CONNS && admin->conns[slot].fd >= 0)
+            slot++;
+        if (slot == ADMIN_MAX_CONNS) {
+            close(fd);
+        } else {
+            admin->conns[slot].fd = fd;
+            *admin->conns[slot].pollfd = (struct pollfd){fd, POLLIN, 0};
+        }
+        fd = accept4(admin->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    }
+}
+
+void admin_dispatch(server_t *serv, game_info_t *game_info)
+{
+    admin_t *admin = serv->admin;
+    admin_conn_t *conn;
+
+    if (!admin || !admin->pollfd)
+        return;
+    for (int i = 0; i < ADMIN_MAX_CONNS; i++) {
+        conn = &admin->conns[i];
+        if (conn->fd >= 0 && conn->pollfd->revents != 0)
+            admin_read(conn, serv, game_info);
+    }
+    if (admin->pollfd->revents & POLLIN)
+        accept_admin_conns(admin);
+}
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_cmd.c
+** File description:
+** dispatch of the admin commands, frequency change and snapshot
+*/
+
+#include "admin.h"
+#include "net_backend.h"
+
+void admin_exec(admin_conn_t *conn, server_t *serv, game_info_t *game_info,
+    char *line)
+{
+    char *args = strchr(line, ' ');
+
+    if (args) {
+        *args = '\0';
+        args++;
+    }
+    for (size_t i = 0; tab_admin_cmd[i].name != NULL; i++) {
+        if (strcmp(tab_admin_cmd[i].name, line) == 0) {
+            tab_admin_cmd[i].fct(conn, serv, game_info, args);
+            return;
+        }
+    }
+    if (line[0] != '\0')
+        admin_write(conn, "ko unknown command %s\n", line);
+}
+
+void admin_help(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    (void)serv;
+    (void)game_info;
+    (void)args;
+    admin_write(conn, "help");
+    for (size_t i = 0; tab_admin_cmd[i].name != NULL; i++)
+        admin_write(conn, " %s", tab_admin_cmd[i].name);
+    admin_write(conn, "\n");
+}
+
+void admin_freq(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    char response[32];
+    char *end = NULL;
+    long freq = args ? strtol(args, &end, 10) : 0;
+
+    if (!args || end == args || *end != '\0' || freq <= 0 ||
+        freq > ADMIN_MAX_FREQ) {
+        admin_write(conn, "ko freq expects a value in 1..%d\n",
+            ADMIN_MAX_FREQ);
+        return;
+    }
+    game_info->freq = (int)freq;
+    // The deadlines planned with the old frequency are recomputed at once
+    plan_wakeup_at(game_info, 0);
+    admin_write(conn, "ok freq=%d\n", game_info->freq);
+    if (!serv->gui_client || !serv->gui_client->client)
+        return;
+    snprintf(response, sizeof(response), "sst %d\n", game_info->freq);
+    net_send(serv->gui_client->client->client_fd, response,
+        strlen(response));
+}
+
+void admin_snapshot(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    admin_clients(conn, serv, game_info, args);
+    admin_tick(conn, serv, game_info, args);
+    admin_loop(conn, serv, game_info, args);
+    admin_lateness(conn, serv, game_info, args);
+    admin_commands(conn, serv, game_info, args);
+    admin_queues(conn, serv, game_info, args);
+    admin_resources(conn, serv, game_info, args);
+    admin_alloc(conn, serv, game_info, args);
+    admin_memory(conn, serv, game_info, args);
+    admin_players(conn, serv, game_info, args);
+}
@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_conn.c
+** File description:
+** line reading and replies of the admin clients
+*/
+
+#include "admin.h"
+#include "net_backend.h"
+#include <errno.h>
+
+void admin_close(admin_conn_t *conn)
+{
+    if (conn->fd >= 0)
+        net_close(conn->fd);
+    if (conn->pollfd)
+        *conn->pollfd = (struct pollfd){-1, 0, 0};
+    conn->fd = -1;
+    conn->in_len = 0;
+    conn->out_len = 0;
+    conn->broken = false;
+}
+
+void admin_flush(admin_conn_t *conn)
+{
+    ssize_t sent;
+
+    if (conn->out_len == 0 || conn->broken) {
+        conn->out_len = 0;
+        return;
+    }
+    sent = send(conn->fd, conn->out, conn->out_len,
+        MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (sent != (ssize_t)conn->out_len)
+        conn->broken = true;
+    conn->out_len = 0;
+}
+
+void admin_write(admin_conn_t *conn, const char *fmt, ...)
+{
+    size_t room = ADMIN_REPLY_SIZE - conn->out_len;
+    va_list ap;
+    int len;
+
+    va_start(ap, fmt);
+    len = vsnprintf(conn->out + conn->out_len, room, fmt, ap);
+    va_end(ap);
+    if (len >= 0 && (size_t)len < room) {
+        conn->out_len += len;
+        return;
+    }
+    admin_flush(conn);
+    va_start(ap, fmt);
+    len = vsnprintf(conn->out, ADMIN_REPLY_SIZE, fmt, ap);
+    va_end(ap);
+    if (len > 0)
+        conn->out_len = ((size_t)len < ADMIN_REPLY_SIZE) ?
+            (size_t)len : ADMIN_REPLY_SIZE - 1;
+}
+
+static void process_admin_lines(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info)
+{
+    char *newline = memchr(conn->in, '\n', conn->in_len);
+    size_t used;
+
+    while (newline) {
+        *newline = '\0';
+        if (newline > conn->in && newline[-1] == '\r')
+            newline[-1] = '\0';
+        admin_exec(conn, serv, game_info, conn->in);
+        used = newline - conn->in + 1;
+        memmove(conn->in, newline + 1, conn->in_len - used);
+        conn->in_len -= used;
+        newline = memchr(conn->in, '\n', conn->in_len);
+    }
+}
+
+void admin_read(admin_conn_t *conn, server_t *serv, game_info_t *game_info)
+{
+    ssize_t ret = recv(conn->fd, conn->in + conn->in_len,
+        ADMIN_LINE_SIZE - conn->in_len, MSG_DONTWAIT);
+
+    if (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        admin_close(conn);
+        return;
+    }
+    if (ret < 0)
+        return;
+    conn->in_len += ret;
+    process_admin_lines(conn, serv, game_info);
+    if (conn->in_len == ADMIN_LINE_SIZE) {
+        admin_write(conn, "ko line too long\n");
+        conn->in_len = 0;
+    }
+    admin_flush(conn);
+    if (conn->broken)
+        admin_close(conn);
+}
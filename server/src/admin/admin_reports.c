@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_reports.c
+** File description:
+** clients, tick rate, loop time and command reports of the admin channel
+*/
+
+#include "admin.h"
+#include "commands.h"
+#include "metrics.h"
+
+static int count_connected(linked_teams_t *team)
+{
+    linked_client_t *client = team->head_client;
+    int count = 0;
+
+    while (client) {
+        if (client->client && client->client->client_fd >= 0)
+            count++;
+        client = client->next;
+    }
+    return count;
+}
+
+void admin_clients(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    linked_teams_t *team = serv->head_team;
+    bool gui = serv->gui_client && serv->gui_client->client;
+
+    (void)game_info;
+    (void)args;
+    admin_write(conn, "clients total=%d gui=%d waiting=%zu", serv->nb_clients,
+        gui, serv->nb_waiting);
+    while (team) {
+        admin_write(conn, " %s=%d", team->name_team, count_connected(team));
+        team = team->next;
+    }
+    admin_write(conn, "\n");
+}
+
+void admin_tick(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    server_metrics_t *metrics = get_server_metrics();
+    double uptime = elapsed_us(&metrics->start) / 1000000.0;
+    double achieved = 0;
+
+    (void)serv;
+    (void)args;
+    if (metrics->ticks_time > 0)
+        achieved = metrics->ticks_done / metrics->ticks_time;
+    admin_write(conn, "tick freq=%d achieved=%.2f loops_per_sec=%.1f "
+        "uptime=%.1f\n", game_info->freq, achieved,
+        (uptime > 0) ? metrics->loops / uptime : 0.0, uptime);
+}
+
+static void write_histogram(admin_conn_t *conn, unsigned long *hist)
+{
+    unsigned long bound = METRICS_FIRST_BUCKET_US;
+
+    for (int i = 0; i < METRICS_NB_BUCKETS - 1; i++) {
+        admin_write(conn, " le_%luus=%lu", bound, hist[i]);
+        bound *= 2;
+    }
+    admin_write(conn, " gt_%luus=%lu\n", bound / 2,
+        hist[METRICS_NB_BUCKETS - 1]);
+}
+
+void admin_loop(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    server_metrics_t *metrics = get_server_metrics();
+
+    (void)serv;
+    (void)game_info;
+    (void)args;
+    admin_write(conn, "loop count=%lu max_us=%lu", metrics->loops,
+        metrics->loop_max_us);
+    write_histogram(conn, metrics->loop_hist);
+}
+
+void admin_lateness(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    server_metrics_t *metrics = get_server_metrics();
+
+    (void)serv;
+    (void)game_info;
+    (void)args;
+    admin_write(conn, "lateness count=%lu avg_us=%lu max_us=%lu",
+        metrics->late_count, metrics->late_count ?
+        metrics->late_total_us / metrics->late_count : 0,
+        metrics->late_max_us);
+    write_histogram(conn, metrics->late_hist);
+}
+
+void admin_commands(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    server_metrics_t *metrics = get_server_metrics();
+    unsigned long count;
+    unsigned long ns;
+
+    (void)serv;
+    (void)game_info;
+    (void)args;
+    admin_write(conn, "commands");
+    for (int i = 0; tab_command_ai[i].name && i < METRICS_NB_CMDS; i++) {
+        count = __atomic_load_n(&metrics->cmd_count[i], __ATOMIC_RELAXED);
+        ns = __atomic_load_n(&metrics->cmd_ns[i], __ATOMIC_RELAXED);
+        admin_write(conn, " %s.count=%lu %s.avg_us=%.1f",
+            tab_command_ai[i].name, count, tab_command_ai[i].name,
+            count ? ns / 1000.0 / count : 0.0);
+    }
+    admin_write(conn, " enqueued=%lu dropped=%lu\n", metrics->cmd_enqueued,
+        metrics->cmd_overflows);
+}
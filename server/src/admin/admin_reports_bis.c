@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_reports_bis.c
+** File description:
+** queue, resource, allocator and player reports of the admin channel
+*/
+
+#include "admin.h"
+#include "incantation.h"
+#include "net_backend.h"
+#include "tick_pool.h"
+#include <malloc.h>
+
+typedef struct queue_stats_s {
+    unsigned long ai_cmds;     // Commands waiting in every player queue
+    unsigned int ai_max;       // Longest player queue
+    size_t out_bytes;          // Bytes not sent yet to the AI clients
+    size_t out_max;            // Longest outbound queue of an AI client
+} queue_stats_t;
+
+static void add_client_queues(linked_client_t *client, queue_stats_t *stats)
+{
+    queue_command_ai_t *q = client->player ? client->player->command : NULL;
+    unsigned int len;
+    size_t pending;
+
+    if (q) {
+        len = q->rear - q->front;
+        stats->ai_cmds += len;
+        stats->ai_max = (len > stats->ai_max) ? len : stats->ai_max;
+    }
+    if (!client->client || client->client->client_fd < 0)
+        return;
+    pending = net_pending(client->client->client_fd);
+    stats->out_bytes += pending;
+    stats->out_max = (pending > stats->out_max) ? pending : stats->out_max;
+}
+
+void admin_queues(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    queue_stats_t stats = {0};
+    size_t gui_out = 0;
+
+    (void)game_info;
+    (void)args;
+    for (linked_teams_t *team = serv->head_team; team; team = team->next) {
+        for (linked_client_t *c = team->head_client; c; c = c->next)
+            add_client_queues(c, &stats);
+    }
+    if (serv->gui_client && serv->gui_client->client)
+        gui_out = net_pending(serv->gui_client->client->client_fd);
+    admin_write(conn, "queues ai_cmds=%lu ai_max=%u out_bytes=%zu "
+        "out_max=%zu gui_out=%zu\n", stats.ai_cmds, stats.ai_max,
+        stats.out_bytes, stats.out_max, gui_out);
+}
+
+void admin_resources(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    long totals[7] = {0};
+    inventory_t *inv;
+
+    (void)serv;
+    (void)args;
+    for (int y = 0; y < game_info->map.height; y++) {
+        for (int x = 0; x < game_info->map.width; x++) {
+            inv = &game_info->map.block[y][x];
+            totals[0] += inv->food;
+            totals[1] += inv->linemate;
+            totals[2] += inv->deraumere;
+            totals[3] += inv->sibur;
+            totals[4] += inv->mendiane;
+            totals[5] += inv->phiras;
+            totals[6] += inv->thystame;
+        }
+    }
+    admin_write(conn, "resources food=%ld linemate=%ld deraumere=%ld "
+        "sibur=%ld mendiane=%ld phiras=%ld thystame=%ld\n", totals[0],
+        totals[1], totals[2], totals[3], totals[4], totals[5], totals[6]);
+}
+
+void admin_alloc(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    struct mallinfo2 info = mallinfo2();
+
+    (void)args;
+    admin_write(conn, "alloc arena=%zu in_use=%zu free=%zu mmap=%zu "
+        "bands=%d ready_cap=%zu dead_cap=%zu rituals=%zu rituals_cap=%zu\n",
+        info.arena, info.uordblks, info.fordblks, info.hblkhd,
+        serv->pool->nb_bands, serv->pool->cap_ready, game_info->cap_dead,
+        game_info->nb_rituals, game_info->cap_rituals);
+}
+
+void admin_players(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    player_t *p;
+
+    (void)game_info;
+    (void)args;
+    for (linked_teams_t *team = serv->head_team; team; team = team->next) {
+        for (linked_client_t *c = team->head_client; c; c = c->next) {
+            p = c->player;
+            if (!p || p->state != ALIVE)
+                continue;
+            admin_write(conn, "player id=%d team=%s x=%d y=%d dir=%d "
+                "level=%d food=%d\n", p->id, team->name_team, p->coords.x,
+                p->coords.y, p->direction, p->level, p->inventory.food);
+        }
+    }
+    admin_write(conn, "end\n");
+}
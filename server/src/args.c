@@ -6,6 +6,7 @@
 */
 
 #include "args.h"
+#include "player.h"
 #include <stddef.h>
 
 static args_t *init_arguments(void)
@@ -20,6 +21,11 @@ static args_t *init_arguments(void)
     args->frequency = -1;
     args->team_names = NULL;
     args->team_count = -1;
+    args->nb_threads = 1;
+    args->backlog = DEFAULT_BACKLOG;
+    args->queue_depth = DEFAULT_QUEUE_DEPTH;
+    args->admin_path = NULL;
+    args->nb_games = 1;
     return args;
 }
 
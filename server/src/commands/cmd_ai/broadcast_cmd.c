@@ -6,6 +6,7 @@
 */
 
 #include "commands.h"
+#include "net_backend.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -41,10 +42,8 @@ static void broadcast_to_all_teams(server_t *serv, coords_t sender_coords,
     linked_teams_t *team = serv->head_team;
 
     while (team != NULL) {
-        if (strcmp(team->name_team, "waiting_clients") != 0) {
-            broadcast_to_team_clients(team->head_client, sender_coords,
-                message, game_info);
-        }
+        broadcast_to_team_clients(team->head_client, sender_coords,
+            message, game_info);
         team = team->next;
     }
 }
@@ -58,7 +57,7 @@ static void send_pbc_to_gui(server_t *serv, int player_id, char *message)
         return;
     }
     snprintf(response, sizeof(response), "pbc #%d %s\n", player_id, message);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 void broadcast(game_info_t *game_info, linked_client_t *player,
@@ -56,7 +56,7 @@ static int calculate_dy_wrapped(int from_y, int to_y, int height)
 
 static double calculate_angle_to_target(int dx, int dy)
 {
-    return atan2(-dy, dx);
+    return atan2(dy, dx);
 }
 
 static int angle_direction_half(double angle)
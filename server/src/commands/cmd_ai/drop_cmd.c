@@ -7,6 +7,7 @@
 
 #include "commands.h"
 #include "ressources.h"
+#include "tick_pool.h"
 #include <string.h>
 
 static ressource_t get_resource_type(char *resource_name)
@@ -91,13 +92,9 @@ static void send_gui_info_drop(server_t *serv, int id,
 {
     char response[64];
 
-    if (!serv->gui_client || !serv->gui_client->client) {
-        printf("[DEBUG] No GUI client connected, cannot send drop info\n");
-        return;
-    }
     snprintf(response, sizeof(response), "pdr #%d %d\n",
         id, resource_type);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    send_gui_message(serv, response, strlen(response));
 }
 
 void drop(game_info_t *game_info, linked_client_t *player,
@@ -105,15 +102,12 @@ void drop(game_info_t *game_info, linked_client_t *player,
 {
     coords_t pos = player->player->coords;
     inventory_t *block = &game_info->map.block[pos.y][pos.x];
-    ressource_t resource_type;
+    ressource_t resource_type = get_resource_type(args);
 
-    printf("[DEBUG] Player fd=%d is dropping resource: %s\n",
-        player->client->client_fd, args);
-    if (!args || strlen(args) == 0 || get_resource_type(args) == ERROR) {
+    if (!args || strlen(args) == 0 || resource_type == ERROR) {
         send_responce(player->client->client_fd, "ko\n");
         return;
     }
-    resource_type = get_resource_type(args);
     if (!check_player_has_resource(&player->player->inventory,
         resource_type)) {
         send_responce(player->client->client_fd, "ko\n");
@@ -121,6 +115,7 @@ void drop(game_info_t *game_info, linked_client_t *player,
     }
     remove_resource_from_player(&player->player->inventory, resource_type);
     add_resource_to_block(block, resource_type);
+    touch_tile(&game_info->map, pos);
     send_responce(player->client->client_fd, "ok\n");
     send_gui_info_drop(serv, player->player->id, resource_type);
 }
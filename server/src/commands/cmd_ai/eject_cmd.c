@@ -9,6 +9,8 @@
 #include "game_info.h"
 #include "player.h"
 #include "socket.h"
+#include "net_backend.h"
+#include "team_slots.h"
 #include <stdio.h>
 #include <sys/socket.h>
 
@@ -26,7 +28,7 @@ static void notify_ejected_player(linked_client_t *player, server_t *serv)
         player->player->coords.x,
         player->player->coords.y,
         player->player->direction);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 static void notify_kill_egg_gui(linked_client_t *client, server_t *serv)
@@ -38,98 +40,56 @@ static void notify_kill_egg_gui(linked_client_t *client, server_t *serv)
         return;
     }
     snprintf(response, sizeof(response), "edi %d\n", client->player->id);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
-static void destroy_team_eggs(linked_teams_t *team, coords_t coords,
-    server_t *serv)
-{
-    linked_client_t *client = team->head_client;
-
-    while (client) {
-        if (client->player->state == EGG &&
-            client->player->coords.x == coords.x &&
-            client->player->coords.y == coords.y) {
-            client->player->state = DEAD;
-            notify_kill_egg_gui(client, serv);
-        }
-        client = client->next;
-    }
-}
-
-static bool should_eject_player(linked_client_t *client,
+static void send_eject_origin(linked_client_t *client,
     linked_client_t *ejector)
 {
-    if (client == ejector)
-        return false;
-    if (client->player->state != ALIVE)
-        return false;
-    return (client->player->coords.x == ejector->player->coords.x &&
-            client->player->coords.y == ejector->player->coords.y);
-}
-
-static void eject_team_players(linked_teams_t *team,
-    linked_client_t *ejector, tdg_t *tdg, server_t *serv)
-{
-    linked_client_t *client = team->head_client;
+    char response[32];
 
-    while (client) {
-        if (should_eject_player(client, ejector)) {
-            move_ejected_player(client->player, tdg->target, tdg->game_info);
-            notify_ejected_player(client, serv);
-        }
-        client = client->next;
-    }
+    if (!client->client)
+        return;
+    snprintf(response, sizeof(response), "eject: %d\n",
+        get_ejection_direction(ejector->player, client->player));
+    send_responce(client->client->client_fd, response);
 }
 
 static void eject_players_from_tile(game_info_t *game_info,
     linked_client_t *ejector, server_t *serv)
 {
-    linked_teams_t *team = serv->head_team;
-    tdg_t tdg;
-
-    tdg.target = get_ejection_target(ejector->player->coords,
+    coords_t target = get_ejection_target(ejector->player->coords,
         ejector->player->direction);
-    tdg.direction = get_ejection_direction(ejector->player, NULL);
-    tdg.game_info = game_info;
-    while (team) {
-        eject_team_players(team, ejector, &tdg, serv);
-        team = team->next;
+    linked_client_t *client = get_tile_players(&game_info->map,
+        ejector->player->coords);
+    linked_client_t *next;
+
+    while (client) {
+        next = client->player->tile_next;
+        if (client != ejector) {
+            move_ejected_player(client, target, game_info);
+            send_eject_origin(client, ejector);
+            notify_ejected_player(client, serv);
+        }
+        client = next;
     }
 }
 
 static void destroy_eggs_on_tile(game_info_t *game_info,
     server_t *serv, coords_t coords)
 {
-    linked_teams_t *team = serv->head_team;
-
-    (void)game_info;
-    while (team) {
-        destroy_team_eggs(team, coords, serv);
-        team = team->next;
-    }
-}
-
-static bool is_egg_on_tile(linked_client_t *client,
-    linked_client_t *ejector)
-{
-    return (client->player->state == EGG &&
-            client->player->coords.x == ejector->player->coords.x &&
-            client->player->coords.y == ejector->player->coords.y);
-}
-
-bool team_has_ejectables(linked_teams_t *team,
-    linked_client_t *ejector)
-{
-    linked_client_t *client = team->head_client;
-
-    while (client) {
-        if (should_eject_player(client, ejector) ||
-            is_egg_on_tile(client, ejector))
-            return true;
-        client = client->next;
+    linked_client_t *egg = get_tile_eggs(&game_info->map, coords);
+    linked_teams_t *team;
+
+    while (egg) {
+        team = egg->player->team;
+        remove_egg(team, egg, &game_info->map);
+        notify_kill_egg_gui(egg, serv);
+        remove_client_from_team(team, egg);
+        if (team->nbr_max_player > 0)
+            team->nbr_max_player--;
+        egg = get_tile_eggs(&game_info->map, coords);
     }
-    return false;
 }
 
 void eject(game_info_t *game_info, linked_client_t *player,
@@ -9,22 +9,20 @@
 #include "game_info.h"
 #include "player.h"
 #include "socket.h"
+#include "net_backend.h"
+#include "team_slots.h"
 #include <stdio.h>
 #include <sys/socket.h>
 
 bool has_players_to_eject(game_info_t *game_info, linked_client_t *ejector,
     server_t *serv)
 {
-    linked_teams_t *team = serv->head_team;
+    map_t *map = &game_info->map;
+    coords_t coords = ejector->player->coords;
 
-    (void)game_info;
-    while (team) {
-        if (strcmp(team->name_team, "waiting_clients") != 0 &&
-            team_has_ejectables(team, ejector))
-            return true;
-        team = team->next;
-    }
-    return false;
+    (void)serv;
+    return map->nb_players[tile_index(map, coords)] > 1 ||
+        get_tile_eggs(map, coords) != NULL;
 }
 
 void eject_responce_gui(server_t *serv, linked_client_t *player)
@@ -37,5 +35,5 @@ void eject_responce_gui(server_t *serv, linked_client_t *player)
         return;
     }
     snprintf(response, sizeof(response), "pex %d\n", player->player->id);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
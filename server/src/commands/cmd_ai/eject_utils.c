@@ -24,23 +24,19 @@ coords_t get_ejection_target(coords_t current, direction_t dir)
 
 int get_ejection_direction(player_t *ejector, player_t *ejected)
 {
-    if (ejector->coords.x == ejected->coords.x &&
-        ejector->coords.y == ejected->coords.y)
+    static const int relative_side[4] = {1, 7, 5, 3};
+    int origin = (ejector->direction + 1) % 4 + 1;
+
+    if (!ejected)
         return 0;
-    if (ejector->direction == UP)
-        return 1;
-    if (ejector->direction == RIGHT)
-        return 3;
-    if (ejector->direction == DOWN)
-        return 5;
-    if (ejector->direction == LEFT)
-        return 7;
-    return 0;
+    return relative_side[(origin - ejected->direction + 4) % 4];
 }
 
-void move_ejected_player(player_t *player, coords_t target,
+void move_ejected_player(linked_client_t *client, coords_t target,
     game_info_t *game_info)
 {
-    player->coords = target;
-    verif_limits(player, game_info);
+    leave_tile(&game_info->map, client);
+    client->player->coords = target;
+    verif_limits(client->player, game_info);
+    enter_tile(&game_info->map, client);
 }
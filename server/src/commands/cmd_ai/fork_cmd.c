@@ -9,22 +9,12 @@
 #include "game_info.h"
 #include "player.h"
 #include "ressources.h"
+#include "net_backend.h"
+#include "team_slots.h"
 #include <sys/socket.h>
 #include <stdlib.h>
 #include <string.h>
 
-static linked_teams_t *find_player_team(server_t *serv, char *team_name)
-{
-    linked_teams_t *current_team = serv->head_team;
-
-    while (current_team) {
-        if (strcmp(current_team->name_team, team_name) == 0)
-            return current_team;
-        current_team = current_team->next;
-    }
-    return NULL;
-}
-
 static direction_t random_direction(void)
 {
     static direction_t directions[] = {UP, RIGHT, DOWN, LEFT};
@@ -34,24 +24,22 @@ static direction_t random_direction(void)
 
 static player_t *create_egg_player(linked_client_t *parent, int *id)
 {
-    player_t *egg = malloc(sizeof(player_t));
+    player_t *egg = calloc(1, sizeof(player_t));
 
     if (!egg)
         return NULL;
     egg->coords = parent->player->coords;
     egg->direction = random_direction();
     egg->team_name = strdup(parent->player->team_name);
+    egg->team = parent->player->team;
     egg->state = EGG;
     egg->was_a_egg = true;
     init_inventory(&egg->inventory);
-    egg->command = malloc(sizeof(queue_command_ai_t));
-    initialize_queue_ai(egg->command);
+    egg->command = create_queue_ai();
     egg->level = 1;
     egg->id = *id;
     egg->is_waiting_start = false;
     (*id)++;
-    memset(&egg->waiting_start, 0, sizeof(struct timespec));
-    memset(&egg->time_eat, 0, sizeof(struct timespec));
     return egg;
 }
 
@@ -66,22 +54,16 @@ static linked_client_t *create_egg_client(player_t *egg_player)
     egg_client->player = egg_player;
     egg_client->client = NULL;
     egg_client->next = NULL;
+    egg_client->prev = NULL;
     egg_client->after_connect = false;
     return egg_client;
 }
 
-static void add_egg_to_team(linked_teams_t *team, linked_client_t *egg)
+static void add_egg_to_team(linked_teams_t *team, linked_client_t *egg,
+    game_info_t *game_info)
 {
-    linked_client_t *current;
-
-    if (!team->head_client) {
-        team->head_client = egg;
-        return;
-    }
-    current = team->head_client;
-    while (current->next)
-        current = current->next;
-    current->next = egg;
+    add_client_to_team(team, egg);
+    add_egg(team, egg, &game_info->map);
 }
 
 static void fork_player_gui_responce(server_t *serv, linked_client_t *player,
@@ -95,17 +77,16 @@ static void fork_player_gui_responce(server_t *serv, linked_client_t *player,
         return;
     }
     snprintf(response, sizeof(response), "pfk #%d\n", player->player->id);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 void fork_player(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args)
 {
-    linked_teams_t *team = find_player_team(serv, player->player->team_name);
+    linked_teams_t *team = get_team(serv, player->player->team_name);
     player_t *egg_player = create_egg_player(player, &game_info->next_id);
     linked_client_t *egg_client;
 
-    (void)game_info;
     (void)args;
     if (!team || !egg_player) {
         send_responce(player->client->client_fd, "ko\n");
@@ -116,7 +97,7 @@ void fork_player(game_info_t *game_info, linked_client_t *player,
         send_responce(player->client->client_fd, "ko\n");
         return;
     }
-    add_egg_to_team(team, egg_client);
+    add_egg_to_team(team, egg_client, game_info);
     team->nbr_max_player++;
     send_responce(player->client->client_fd, "ok\n");
     fork_player_gui_responce(serv, player, egg_client);
@@ -7,8 +7,10 @@
 
 #include "commands.h"
 #include "game_info.h"
+#include "incantation.h"
 #include "player.h"
 #include "socket.h"
+#include "net_backend.h"
 #include <stdio.h>
 
 static const int elevation_reqs[7][7] = {
@@ -21,39 +23,6 @@ static const int elevation_reqs[7][7] = {
     {6, 2, 2, 2, 2, 2, 1}
 };
 
-static int count_players_coordo(linked_client_t *client, coords_t coords,
-    int level)
-{
-    int count = 0;
-
-    printf("[DEBUG] Counting players at coords\n");
-    while (client != NULL) {
-        if (client->player != NULL &&
-            client->player->coords.x == coords.x &&
-            client->player->coords.y == coords.y &&
-            client->player->level == level &&
-            client->player->state == ALIVE) {
-            count++;
-        }
-        client = client->next;
-    }
-    return count;
-}
-
-static int count_players_same_level(server_t *serv, coords_t coords, int level)
-{
-    linked_teams_t *team = serv->head_team;
-    int count = 0;
-
-    while (team != NULL) {
-        if (strcmp(team->name_team, "waiting_clients") != 0) {
-            count += count_players_coordo(team->head_client, coords, level);
-        }
-        team = team->next;
-    }
-    return count;
-}
-
 static bool check_tile_resources(inventory_t *tile_inv, int level)
 {
     const int *reqs = elevation_reqs[level - 1];
@@ -73,24 +42,33 @@ static bool check_tile_resources(inventory_t *tile_inv, int level)
     return true;
 }
 
-static bool check_elevation_requirements(game_info_t *game_info,
-    server_t *serv, linked_client_t *player)
+bool is_valid_member(incantation_t *ritual, linked_client_t *member)
 {
-    int level = player->player->level;
-    coords_t coords = player->player->coords;
-    int player_count;
-    inventory_t *tile_inv;
+    return (member != NULL && member->client != NULL &&
+        member->player->state == ALIVE &&
+        member->player->level == ritual->level &&
+        member->player->coords.x == ritual->coords.x &&
+        member->player->coords.y == ritual->coords.y);
+}
 
-    if (level >= 8)
+bool can_elevate(game_info_t *game_info, incantation_t *ritual)
+{
+    int count = 0;
+
+    if (ritual->level < 1 || ritual->level >= 8)
         return false;
-    player_count = count_players_same_level(serv, coords, level);
-    if (player_count < elevation_reqs[level - 1][0])
+    for (size_t i = 0; i < ritual->nb_members; i++) {
+        if (is_valid_member(ritual, ritual->members[i]))
+            count++;
+    }
+    if (count < elevation_reqs[ritual->level - 1][0])
         return false;
-    tile_inv = &game_info->map.block[coords.y][coords.x];
-    return check_tile_resources(tile_inv, level);
+    return check_tile_resources(
+        &game_info->map.block[ritual->coords.y][ritual->coords.x],
+        ritual->level);
 }
 
-static void consume_elevation_resources(game_info_t *game_info,
+void consume_elevation_resources(game_info_t *game_info,
     coords_t coords, int level)
 {
     const int *reqs = elevation_reqs[level - 1];
@@ -102,82 +80,51 @@ static void consume_elevation_resources(game_info_t *game_info,
     tile_inv->mendiane -= reqs[4];
     tile_inv->phiras -= reqs[5];
     tile_inv->thystame -= reqs[6];
+    touch_tile(&game_info->map, coords);
 }
 
-static void send_current_level(int client_fd, int level)
-{
-    char response[64];
-
-    snprintf(response, sizeof(response), "Current level: %d\n", level);
-    send_responce(client_fd, response);
-}
-
-static void send_to_gui_player_lvlup(server_t *serv, player_t *player)
+static void notify_start_incantation(server_t *serv, incantation_t *ritual)
 {
-    char response[64];
+    char response[100];
 
-    if (!serv->gui_client || !serv->gui_client->client) {
-        printf("[DEBUG] No GUI client connected, cannot send level up\n");
+    if (!serv->gui_client || !serv->gui_client->client)
         return;
-    }
-    snprintf(response, sizeof(response), "plv #%d %d\n", player->id,
-        player->level);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    snprintf(response, sizeof(response), "pic %d %d #%d\n",
+        ritual->coords.x, ritual->coords.y, ritual->level);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
-static void elevate_team_players_same_level(linked_client_t *client,
-    coords_t coords, int level, server_t *serv)
+static void start_incantation(game_info_t *game_info, server_t *serv,
+    incantation_t *ritual, int time)
 {
-    printf("[DEBUG] Elevating players at coords\n");
-    while (client != NULL) {
-        if (client->player != NULL &&
-            client->player->coords.x == coords.x &&
-            client->player->coords.y == coords.y &&
-            client->player->level == level &&
-            client->player->state == ALIVE) {
-            client->player->level++;
-            client->player->is_incantation = false;
-            send_current_level(client->client->client_fd,
-                client->player->level);
-            send_to_gui_player_lvlup(serv, client->player);
-        }
-        client = client->next;
-    }
-}
-
-static void elevate_players_same_level(server_t *serv, coords_t coords,
-    int level)
-{
-    linked_teams_t *team = serv->head_team;
-
-    while (team != NULL) {
-        if (strcmp(team->name_team, "waiting_clients") != 0) {
-            elevate_team_players_same_level(team->head_client, coords,
-            level, serv);
-        }
-        team = team->next;
+    linked_client_t *member;
+
+    ritual->end_time = get_time_seconds() + (double)time / game_info->freq;
+    for (size_t i = 0; i < ritual->nb_members; i++) {
+        member = ritual->members[i];
+        member->player->ritual = ritual;
+        member->player->is_incantation = true;
+        send_responce(member->client->client_fd, "Elevation underway\n");
     }
+    notify_start_incantation(serv, ritual);
+    schedule_incantation(game_info, ritual);
 }
 
 void incantation(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args)
 {
-    char response[64];
+    incantation_t *ritual;
 
     (void)args;
     printf("[DEBUG] Player fd=%d is attempting to incantate\n",
         player->client->client_fd);
-    if (!check_elevation_requirements(game_info, serv, player)) {
+    ritual = create_incantation(&game_info->map, player);
+    if (!ritual || !can_elevate(game_info, ritual)) {
+        destroy_incantation(ritual);
         send_responce(player->client->client_fd, "ko\n");
-        send_lvlup_failed_gui(serv, player->player);
+        finish_player_command(player);
         return;
     }
-    consume_elevation_resources(game_info, player->player->coords,
-        player->player->level);
-    elevate_players_same_level(serv, player->player->coords,
-        player->player->level);
-    snprintf(response, sizeof(response),
-        "Elevation underway\n");
-    send_responce(player->client->client_fd, response);
-    send_lvlup_finish_gui(serv, player->player);
+    start_incantation(game_info, serv, ritual,
+        peek(player->player->command)->time);
 }
@@ -7,11 +7,13 @@
 
 #include "commands.h"
 #include "game_info.h"
+#include "incantation.h"
 #include "player.h"
 #include "socket.h"
+#include "net_backend.h"
 #include <stdio.h>
 
-void send_lvlup_finish_gui(server_t *serv, player_t *player)
+void send_lvlup_finish_gui(server_t *serv, coords_t coords)
 {
     char response[64];
 
@@ -20,12 +22,12 @@ void send_lvlup_finish_gui(server_t *serv, player_t *player)
         printf(" cannot send level up finish\n");
         return;
     }
-    snprintf(response, sizeof(response), "pie %d %d 1\n", player->coords.x,
-        player->coords.y);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    snprintf(response, sizeof(response), "pie %d %d 1\n", coords.x,
+        coords.y);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
-void send_lvlup_failed_gui(server_t *serv, player_t *player)
+void send_lvlup_failed_gui(server_t *serv, coords_t coords)
 {
     char response[64];
 
@@ -34,7 +36,65 @@ void send_lvlup_failed_gui(server_t *serv, player_t *player)
         printf(" cannot send level up finish\n");
         return;
     }
-    snprintf(response, sizeof(response), "pie %d %d 0\n", player->coords.x,
-        player->coords.y);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    snprintf(response, sizeof(response), "pie %d %d 0\n", coords.x,
+        coords.y);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
+}
+
+static void send_to_gui_player_lvlup(server_t *serv, player_t *player)
+{
+    char response[64];
+
+    if (!serv->gui_client || !serv->gui_client->client) {
+        printf("[DEBUG] No GUI client connected, cannot send level up\n");
+        return;
+    }
+    snprintf(response, sizeof(response), "plv #%d %d\n", player->id,
+        player->level);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
+}
+
+static void elevate_member(server_t *serv, linked_client_t *member)
+{
+    char response[64];
+
+    member->player->level++;
+    add_max_level_player(serv, member->player);
+    snprintf(response, sizeof(response), "Current level: %d\n",
+        member->player->level);
+    send_responce(member->client->client_fd, response);
+    send_to_gui_player_lvlup(serv, member->player);
+}
+
+static void answer_members(server_t *serv, incantation_t *ritual,
+    bool success)
+{
+    linked_client_t *member;
+
+    for (size_t i = 0; i < ritual->nb_members; i++) {
+        member = ritual->members[i];
+        if (!is_valid_member(ritual, member))
+            continue;
+        if (success)
+            elevate_member(serv, member);
+        else
+            send_responce(member->client->client_fd, "ko\n");
+    }
+}
+
+void finish_incantation(server_t *serv, game_info_t *game_info,
+    incantation_t *ritual)
+{
+    bool success = can_elevate(game_info, ritual);
+
+    if (success)
+        consume_elevation_resources(game_info, ritual->coords,
+            ritual->level);
+    answer_members(serv, ritual, success);
+    if (success)
+        send_lvlup_finish_gui(serv, ritual->coords);
+    else
+        send_lvlup_failed_gui(serv, ritual->coords);
+    if (ritual->leader != NULL)
+        finish_player_command(ritual->leader);
 }
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** incantation_ritual.c
+** File description:
+** creation of a ritual and bookkeeping of its participants
+*/
+
+#include "incantation.h"
+
+static bool add_member(incantation_t *ritual, linked_client_t *member)
+{
+    linked_client_t **members;
+    size_t new_cap;
+
+    if (ritual->nb_members == ritual->cap_members) {
+        new_cap = (ritual->cap_members == 0) ? 8 : ritual->cap_members * 2;
+        members = realloc(ritual->members,
+            sizeof(linked_client_t *) * new_cap);
+        if (!members) {
+            perror("realloc");
+            return false;
+        }
+        ritual->members = members;
+        ritual->cap_members = new_cap;
+    }
+    ritual->members[ritual->nb_members] = member;
+    ritual->nb_members++;
+    return true;
+}
+
+// The tile list holds exactly the players standing with the leader
+static void gather_tile_members(incantation_t *ritual, linked_client_t *client)
+{
+    player_t *player;
+
+    while (client != NULL) {
+        player = client->player;
+        if (client->client != NULL &&
+            player->state == ALIVE && player->ritual == NULL &&
+            player->level == ritual->level)
+            add_member(ritual, client);
+        client = player->tile_next;
+    }
+}
+
+incantation_t *create_incantation(map_t *map, linked_client_t *leader)
+{
+    incantation_t *ritual = calloc(1, sizeof(incantation_t));
+
+    if (!ritual) {
+        perror("calloc");
+        return NULL;
+    }
+    ritual->coords = leader->player->coords;
+    ritual->level = leader->player->level;
+    ritual->leader = leader;
+    gather_tile_members(ritual, get_tile_players(map, ritual->coords));
+    return ritual;
+}
+
+void destroy_incantation(incantation_t *ritual)
+{
+    player_t *player;
+
+    if (!ritual)
+        return;
+    for (size_t i = 0; i < ritual->nb_members; i++) {
+        if (ritual->members[i] == NULL)
+            continue;
+        player = ritual->members[i]->player;
+        player->ritual = NULL;
+        player->is_incantation = false;
+    }
+    free(ritual->members);
+    free(ritual);
+}
+
+void detach_from_incantation(linked_client_t *client)
+{
+    incantation_t *ritual;
+
+    if (!client || !client->player || !client->player->ritual)
+        return;
+    ritual = client->player->ritual;
+    for (size_t i = 0; i < ritual->nb_members; i++) {
+        if (ritual->members[i] == client)
+            ritual->members[i] = NULL;
+    }
+    if (ritual->leader == client)
+        ritual->leader = NULL;
+    client->player->ritual = NULL;
+    client->player->is_incantation = false;
+}
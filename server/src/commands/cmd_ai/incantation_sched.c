@@ -0,0 +1,101 @@
+/*
+** EPITECH PROJECT, 2025
+** incantation_sched.c
+** File description:
+** min heap of the rituals ordered by their absolute completion time
+*/
+
+#include "incantation.h"
+#include "metrics.h"
+
+double get_time_seconds(void)
+{
+    struct timespec now;
+
+    get_current_time(&now);
+    return now.tv_sec + now.tv_nsec / 1000000000.0;
+}
+
+static void swap_rituals(incantation_t **heap, size_t a, size_t b)
+{
+    incantation_t *tmp = heap[a];
+
+    heap[a] = heap[b];
+    heap[b] = tmp;
+}
+
+void schedule_incantation(game_info_t *game_info, incantation_t *ritual)
+{
+    incantation_t **heap;
+    size_t i = game_info->nb_rituals;
+    size_t new_cap;
+
+    if (i == game_info->cap_rituals) {
+        new_cap = (i == 0) ? 16 : i * 2;
+        heap = realloc(game_info->rituals, sizeof(incantation_t *) * new_cap);
+        if (!heap) {
+            perror("realloc");
+            return;
+        }
+        game_info->rituals = heap;
+        game_info->cap_rituals = new_cap;
+    }
+    game_info->rituals[i] = ritual;
+    game_info->nb_rituals++;
+    for (; i > 0 && game_info->rituals[(i - 1) / 2]->end_time >
+        game_info->rituals[i]->end_time; i = (i - 1) / 2)
+        swap_rituals(game_info->rituals, i, (i - 1) / 2);
+}
+
+static incantation_t *pop_incantation(game_info_t *game_info)
+{
+    incantation_t **heap = game_info->rituals;
+    incantation_t *top = heap[0];
+    size_t i = 0;
+    size_t child;
+
+    game_info->nb_rituals--;
+    heap[0] = heap[game_info->nb_rituals];
+    while (2 * i + 1 < game_info->nb_rituals) {
+        child = 2 * i + 1;
+        if (child + 1 < game_info->nb_rituals &&
+            heap[child + 1]->end_time < heap[child]->end_time)
+            child++;
+        if (heap[i]->end_time <= heap[child]->end_time)
+            break;
+        swap_rituals(heap, i, child);
+        i = child;
+    }
+    return top;
+}
+
+void resolve_incantations(server_t *serv, game_info_t *game_info)
+{
+    incantation_t *ritual;
+    double now;
+
+    if (game_info->nb_rituals == 0)
+        return;
+    now = get_time_seconds();
+    while (game_info->nb_rituals > 0 &&
+        game_info->rituals[0]->end_time <= now) {
+        ritual = pop_incantation(game_info);
+        record_lateness(now - ritual->end_time);
+        finish_incantation(serv, game_info, ritual);
+        destroy_incantation(ritual);
+        plan_wakeup_at(game_info, 0);
+    }
+    if (game_info->nb_rituals > 0)
+        plan_wakeup_at(game_info, game_info->rituals[0]->end_time);
+}
+
+void destroy_incantations(game_info_t *game_info)
+{
+    for (size_t i = 0; i < game_info->nb_rituals; i++) {
+        free(game_info->rituals[i]->members);
+        free(game_info->rituals[i]);
+    }
+    free(game_info->rituals);
+    game_info->rituals = NULL;
+    game_info->nb_rituals = 0;
+}
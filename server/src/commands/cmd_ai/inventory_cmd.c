@@ -16,8 +16,6 @@ void inventory(game_info_t *game_info, linked_client_t *player,
     (void)args;
     (void)game_info;
     (void)serv;
-    printf("[DEBUG] Player fd=%d requested inventory\n",
-        player->client->client_fd);
     snprintf(response, sizeof(response), "[food %d, linemate %d, "
     "deraumere %d, sibur %d, mendiane %d, phiras %d, thystame %d]\n",
     player->player->inventory.food,
@@ -10,96 +10,81 @@
 #include "player.h"
 #include "ressources.h"
 #include "socket.h"
+#include "net_backend.h"
 #include <sys/socket.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
-static void apply_world_limits(coords_t *coords, game_info_t *game_info)
+static unsigned long get_cone(map_t *map, player_t *player,
+    coords_t *cone, int nb_tiles)
 {
-    if (coords->x < 0)
-        coords->x = game_info->map.width - 1;
-    if (coords->x >= game_info->map.width)
-        coords->x = 0;
-    if (coords->y < 0)
-        coords->y = game_info->map.height - 1;
-    if (coords->y >= game_info->map.height)
-        coords->y = 0;
+    const look_offset_t *offsets = get_look_offsets(player->direction);
+    unsigned long sum = 0;
+
+    for (int i = 0; i < nb_tiles; i++) {
+        cone[i].x = wrap_coord(player->coords.x + offsets[i].x, map->width);
+        cone[i].y = wrap_coord(player->coords.y + offsets[i].y, map->height);
+        sum += map->version[tile_index(map, cone[i])];
+    }
+    return sum;
 }
 
-static int process_single_tile(game_info_t *game_info,
-    server_t *serv, player_t *player, look_utils_bis_t *lsr)
+static bool is_look_cached(look_cache_t *cache, player_t *player,
+    unsigned long sum)
 {
-    coords_t tile_coords;
-    char tile_content[MAX_TILE_CONTENT];
-    int line = lsr->line;
-    int side = lsr->side;
-    char *response = lsr->response;
-
-    get_tile_coords(player, line, side + line, &tile_coords);
-    apply_world_limits(&tile_coords, game_info);
-    tile_content[0] = '\0';
-    if (get_tile_content_secure(game_info, serv, &tile_coords,
-        tile_content) != 0)
-        return -1;
-    if (add_tile_to_response_secure(response, tile_content) != 0)
-        return -1;
-    return 0;
+    return cache->response && cache->level == player->level &&
+        cache->direction == player->direction &&
+        cache->coords.x == player->coords.x &&
+        cache->coords.y == player->coords.y && cache->sum == sum;
 }
 
-static int process_vision_line(game_info_t *game_info,
-    server_t *serv, player_t *player, look_utils_t *lrp)
+static int build_look(look_cache_t *cache, map_t *map,
+    coords_t *cone, int nb_tiles)
 {
-    int line = lrp->line;
-    char *response = lrp->response;
-    int *pos = lrp->pos;
-    look_utils_bis_t lsr = {line, 0, response};
-
-    for (int side = -line; side <= line; side++) {
-        if (*pos > 1000)
+    cache->len = 0;
+    cache->level = 0;
+    if (append_look(cache, "[", 1) != 0)
+        return -1;
+    for (int i = 0; i < nb_tiles; i++) {
+        if (i > 0 && append_look(cache, ",", 1) != 0)
             return -1;
-        lsr.side = side;
-        if (process_single_tile(game_info, serv, player, &lsr) != 0)
+        if (append_look_tile(cache, map, cone[i]) != 0)
             return -1;
-        (*pos)++;
     }
-    return 0;
+    return append_look(cache, "]\n", 2);
 }
 
-static int build_look_response_secure(game_info_t *game_info,
-    server_t *serv, player_t *player, char *response)
+static void store_look_key(look_cache_t *cache, player_t *player,
+    unsigned long sum)
 {
-    int vision_range = player->level;
-    int pos = 0;
-    look_utils_t lrp = {0, response, &pos};
-
-    strcpy(response, "[");
-    for (int line = 0; line <= vision_range; line++) {
-        lrp.line = line;
-        lrp.response = response;
-        lrp.pos = &pos;
-        if (process_vision_line(game_info, serv, player, &lrp) != 0)
-            return -1;
-    }
-    if (safe_strcat(response, "]\n", MAX_RESPONSE_SIZE) != 0)
-        return -1;
-    return 0;
+    cache->coords = player->coords;
+    cache->direction = player->direction;
+    cache->level = player->level;
+    cache->sum = sum;
 }
 
 void look(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args)
 {
-    char response[MAX_RESPONSE_SIZE] = {0};
+    coords_t cone[LOOK_MAX_TILES];
+    look_cache_t *cache = &player->player->look;
+    int nb_tiles = get_look_tiles(player->player->level);
+    unsigned long sum;
 
+    (void)serv;
     (void)args;
-    if (!game_info || !player || !player->player || !serv) {
+    if (!game_info->map.version || !game_info->map.nb_players) {
         send_responce(player->client->client_fd, "ko\n");
         return;
     }
-    if (build_look_response_secure(game_info, serv,
-        player->player, response) != 0) {
-        send_responce(player->client->client_fd, "ko\n");
-        return;
+    sum = get_cone(&game_info->map, player->player, cone, nb_tiles);
+    if (!is_look_cached(cache, player->player, sum)) {
+        if (build_look(cache, &game_info->map, cone, nb_tiles) != 0) {
+            send_responce(player->client->client_fd, "ko\n");
+            return;
+        }
+        store_look_key(cache, player->player, sum);
     }
-    send_responce(player->client->client_fd, response);
+    net_send(player->client->client_fd, cache->response, cache->len);
 }
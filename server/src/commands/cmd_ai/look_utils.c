@@ -7,64 +7,59 @@
 
 #include "commands.h"
 
-static void look_coord_up(look_coords_t *vecs)
+static const look_coords_t look_vectors[] = {
+    {0, 1, 1, 0},              // UP
+    {1, 0, 0, -1},             // RIGHT
+    {0, -1, -1, 0},            // DOWN
+    {-1, 0, 0, 1}              // LEFT
+};
+
+static look_offset_t look_offsets[4][LOOK_MAX_TILES];
+
+static void fill_look_offsets(const look_coords_t *vecs,
+    look_offset_t *offsets)
 {
-    vecs->fx = 0;
-    vecs->fy = 1;
-    vecs->rx = 1;
-    vecs->ry = 0;
+    int i = 0;
+
+    for (int line = 0; line <= LOOK_MAX_LEVEL; line++) {
+        for (int side = -line; side <= line; side++) {
+            offsets[i].x = vecs->fx * line + vecs->rx * side;
+            offsets[i].y = vecs->fy * line + vecs->ry * side;
+            i++;
+        }
+    }
 }
 
-static void look_coord_right(look_coords_t *vecs)
+void init_look_offsets(void)
 {
-    vecs->fx = 1;
-    vecs->fy = 0;
-    vecs->rx = 0;
-    vecs->ry = -1;
+    for (int dir = 0; dir < 4; dir++)
+        fill_look_offsets(&look_vectors[dir], look_offsets[dir]);
 }
 
-static void look_coord_down(look_coords_t *vecs)
+const look_coords_t *get_direction_frame(direction_t direction)
 {
-    vecs->fx = 0;
-    vecs->fy = -1;
-    vecs->rx = -1;
-    vecs->ry = 0;
+    if (direction < UP || direction > LEFT)
+        return &look_vectors[LEFT - 1];
+    return &look_vectors[direction - 1];
 }
 
-static void look_coord_left(look_coords_t *vecs)
+const look_offset_t *get_look_offsets(direction_t direction)
 {
-    vecs->fx = -1;
-    vecs->fy = 0;
-    vecs->rx = 0;
-    vecs->ry = 1;
+    if (direction < UP || direction > LEFT)
+        return look_offsets[LEFT - 1];
+    return look_offsets[direction - 1];
 }
 
-void get_direction_vectors(direction_t dir, look_coords_t *coords)
+int get_look_tiles(int level)
 {
-    switch (dir) {
-        case UP:
-            look_coord_up(coords);
-            break;
-        case RIGHT:
-            look_coord_right(coords);
-            break;
-        case DOWN:
-            look_coord_down(coords);
-            break;
-        case LEFT:
-        default:
-            look_coord_left(coords);
-            break;
-    }
+    if (level > LOOK_MAX_LEVEL)
+        level = LOOK_MAX_LEVEL;
+    if (level < 0)
+        level = 0;
+    return (level + 1) * (level + 1);
 }
 
-void get_tile_coords(player_t *player, int line, int pos, coords_t *coords)
+int wrap_coord(int value, int size)
 {
-    look_coords_t vecs;
-
-    get_direction_vectors(player->direction, &vecs);
-    vecs.relative_x = vecs.fx * line + vecs.rx * (pos - line);
-    vecs.relative_y = vecs.fy * line + vecs.ry * (pos - line);
-    coords->x = player->coords.x + vecs.relative_x;
-    coords->y = player->coords.y + vecs.relative_y;
+    return ((value % size) + size) % size;
 }
@@ -7,135 +7,68 @@
 
 #include "commands.h"
 
-int safe_strcat(char *dest, const char *src, size_t dest_size)
-{
-    size_t dest_len = strlen(dest);
-    size_t src_len = strlen(src);
-
-    if (dest_len + src_len + 1 >= dest_size) {
-        printf("[WARNING] Buffer overflow prevented in safe_strcat\n");
-        return -1;
-    }
-    strcat(dest, src);
-    return 0;
-}
+static const char *look_objects[] = {"player", "food", "linemate",
+    "deraumere", "sibur", "mendiane", "phiras", "thystame"};
 
-static void counter_players_on_tile(linked_client_t *client,
-    coords_t *coords, int *count)
+static bool grow_look(look_cache_t *cache, size_t needed)
 {
-    if (client->player && client->player->coords.x == coords->x
-        && client->player->coords.y == coords->y
-        && client->player->state == ALIVE)
-        (*count)++;
-}
-
-static int count_players_on_tile(server_t *serv, coords_t *coords)
-{
-    linked_teams_t *team = serv->head_team;
-    linked_client_t *client;
-    int count = 0;
-
-    while (team) {
-        if (strcmp(team->name_team, "waiting_clients") == 0) {
-            team = team->next;
-            continue;
-        }
-        client = team->head_client;
-        while (client) {
-            counter_players_on_tile(client, coords, &count);
-            client = client->next;
-        }
-        team = team->next;
+    size_t new_cap = (cache->cap == 0) ? 256 : cache->cap;
+    char *data;
+
+    while (new_cap < needed)
+        new_cap *= 2;
+    if (new_cap == cache->cap)
+        return true;
+    data = realloc(cache->response, new_cap);
+    if (!data) {
+        perror("realloc");
+        return false;
     }
-    return count;
+    cache->response = data;
+    cache->cap = new_cap;
+    return true;
 }
 
-static int append_object_to_tile(char *tile_content, const char *object)
+int append_look(look_cache_t *cache, const char *str, size_t len)
 {
-    if (strlen(tile_content) > 0) {
-        if (safe_strcat(tile_content, " ", MAX_TILE_CONTENT) != 0)
-            return -1;
-    }
-    if (safe_strcat(tile_content, object, MAX_TILE_CONTENT) != 0)
+    if (cache->len + len + 1 > MAX_RESPONSE_SIZE) {
+        printf("[WARNING] Look answer too long, sending ko\n");
         return -1;
-    return 0;
-}
-
-static int add_objects_str_secure(char *tile_content, inventory_t *inv, int i)
-{
-    int quantities[] = {inv->food, inv->linemate, inv->deraumere,
-        inv->sibur, inv->mendiane, inv->phiras, inv->thystame};
-    char *objects[] = {"food", "linemate", "deraumere", "sibur",
-        "mendiane", "phiras", "thystame"};
-
-    for (int j = 0; j < quantities[i]; j++) {
-        if (append_object_to_tile(tile_content, objects[i]) != 0)
-            return -1;
-    }
-    return 0;
-}
-
-static int add_tile_objects_secure(char *tile_content, inventory_t *inv)
-{
-    for (int i = 0; i < 7; i++) {
-        if (add_objects_str_secure(tile_content, inv, i) != 0) {
-            return -1;
-        }
-    }
-    return 0;
-}
-
-static int append_player_to_tile(char *content)
-{
-    if (strlen(content) > 0) {
-        if (safe_strcat(content, " ", MAX_TILE_CONTENT) != 0)
-            return -1;
     }
-    if (safe_strcat(content, "player", MAX_TILE_CONTENT) != 0)
+    if (!grow_look(cache, cache->len + len + 1))
         return -1;
+    memcpy(cache->response + cache->len, str, len);
+    cache->len += len;
+    cache->response[cache->len] = '\0';
     return 0;
 }
 
-int get_tile_content_secure(game_info_t *game_info, server_t *serv,
-    coords_t *coords, char *content)
+static int append_objects(look_cache_t *cache, const char *object,
+    int count, bool *first)
 {
-    int player_count;
-    inventory_t *tile_inv;
+    size_t len = strlen(object);
 
-    if (coords->x < 0 || coords->x >= game_info->map.width ||
-        coords->y < 0 || coords->y >= game_info->map.height) {
-        content[0] = '\0';
-        return -1;
-    }
-    content[0] = '\0';
-    player_count = count_players_on_tile(serv, coords);
-    for (int i = 0; i < player_count; i++) {
-        if (append_player_to_tile(content) != 0)
+    for (int i = 0; i < count; i++) {
+        if (!*first && append_look(cache, " ", 1) != 0)
+            return -1;
+        *first = false;
+        if (append_look(cache, object, len) != 0)
             return -1;
     }
-    tile_inv = &game_info->map.block[coords->y][coords->x];
-    if (add_tile_objects_secure(content, tile_inv) != 0)
-        return -1;
     return 0;
 }
 
-int add_tile_to_response_secure(char *response, char *tile_content)
+int append_look_tile(look_cache_t *cache, map_t *map, coords_t coords)
 {
-    if (strlen(response) > 1) {
-        if (safe_strcat(response, ",", MAX_RESPONSE_SIZE) != 0)
+    inventory_t *inv = &map->block[coords.y][coords.x];
+    int counts[] = {map->nb_players[tile_index(map, coords)], inv->food,
+        inv->linemate, inv->deraumere, inv->sibur, inv->mendiane,
+        inv->phiras, inv->thystame};
+    bool first = true;
+
+    for (int i = 0; i < 8; i++) {
+        if (append_objects(cache, look_objects[i], counts[i], &first) != 0)
             return -1;
     }
-    if (safe_strcat(response, tile_content, MAX_RESPONSE_SIZE) != 0)
-        return -1;
     return 0;
 }
-
-int calculate_total_tiles(int vision_range)
-{
-    int total_tiles = 0;
-
-    for (int line = 0; line <= vision_range; line++) {
-        total_tiles += (2 * line + 1);
-    }
-    return total_tiles;
-}
@@ -8,6 +8,7 @@
 #include "commands.h"
 #include "game_info.h"
 #include "player.h"
+#include "tick_pool.h"
 #include <sys/socket.h>
 
 void move_player(player_t *player, direction_t dir)
@@ -36,29 +37,24 @@ void verif_limits(player_t *player, game_info_t *game_info)
 
 static void forward_gui_responce(server_t *serv, linked_client_t *player)
 {
-    char response[2098];
+    char response[64];
 
-    if (!serv->gui_client || !serv->gui_client->client) {
-        printf("[DEBUG] No GUI client connected,");
-        printf(" cannot send forward response\n");
-        return;
-    }
     snprintf(response, sizeof(response), "ppo #%d %d %d %d\n",
         player->player->id,
         player->player->coords.x,
         player->player->coords.y,
         player->player->direction);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    send_gui_message(serv, response, strlen(response));
 }
 
 void forward(game_info_t *game_info, linked_client_t *player,
     server_t *serv, char *args)
 {
     (void)args;
-    printf("[DEBUG] Player fd=%d is moving forward\n",
-        player->client->client_fd);
+    leave_tile(&game_info->map, player);
     move_player(player->player, player->player->direction);
     verif_limits(player->player, game_info);
+    enter_tile(&game_info->map, player);
     send_responce(player->client->client_fd, "ok\n");
     forward_gui_responce(serv, player);
 }
@@ -82,8 +78,6 @@ void right(game_info_t *game_info, linked_client_t *player,
     (void)game_info;
     (void)serv;
     (void)args;
-    printf("[DEBUG] Player fd=%d is turning right\n",
-        player->client->client_fd);
     player->player->direction = change_dir_right(player->player->direction);
     send_responce(player->client->client_fd, "ok\n");
     forward_gui_responce(serv, player);
@@ -108,8 +102,6 @@ void left(game_info_t *game_info, linked_client_t *player,
     (void)game_info;
     (void)serv;
     (void)args;
-    printf("[DEBUG] Player fd=%d is turning left\n",
-        player->client->client_fd);
     player->player->direction = change_dir_left(player->player->direction);
     send_responce(player->client->client_fd, "ok\n");
     forward_gui_responce(serv, player);
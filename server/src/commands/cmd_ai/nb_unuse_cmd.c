@@ -6,34 +6,17 @@
 */
 
 #include "commands.h"
+#include "game_info.h"
 #include "player.h"
 #include "socket.h"
+#include "team_slots.h"
 #include <stdio.h>
 
-static int count_remaining_slots(linked_teams_t *team)
-{
-    linked_client_t *tmp = team->head_client;
-    int count = 0;
-
-    while (tmp) {
-        if (tmp->player->state == UNUSED || tmp->player->state == EGG)
-            count++;
-        tmp = tmp->next;
-    }
-    return count;
-}
-
 int get_nb_slot_team(char *team, server_t *serv)
 {
-    linked_teams_t *tmp = serv->head_team;
+    linked_teams_t *tmp = get_team(serv, team);
 
-    while (tmp != NULL) {
-        if (strcmp(tmp->name_team, team) == 0) {
-            return count_remaining_slots(tmp);
-        }
-        tmp = tmp->next;
-    }
-    return -1;
+    return (tmp != NULL) ? count_team_slots(tmp) : -1;
 }
 
 void nb_unuse_slot(game_info_t *game_info, linked_client_t *player,
@@ -6,6 +6,7 @@
 */
 
 #include "commands.h"
+#include "tick_pool.h"
 
 static ressource_t get_resource_type(char *resource_name)
 {
@@ -83,18 +84,6 @@ static void add_resource_to_player(inventory_t *inventory, ressource_t type)
         (*res)++;
 }
 
-static void print_take(linked_client_t *player, char *args, inventory_t *block)
-{
-    ressource_t resource_type = get_resource_type(args);
-    coords_t pos = player->player->coords;
-
-    printf("type : %d\n", resource_type);
-    printf("Player fd=%d is taking resource %s\n",
-        player->client->client_fd, args);
-    printf("for map block at (%d, %d) nb food : %d\n",
-        pos.x, pos.y, block->linemate);
-}
-
 static bool validate_take_request(linked_client_t *player, inventory_t *block,
     ressource_t resource_type)
 {
@@ -112,15 +101,11 @@ static bool validate_take_request(linked_client_t *player, inventory_t *block,
 static void send_take_gui_info(server_t *serv, int player_id,
     ressource_t resource_type)
 {
-    char response[4098];
+    char response[64];
 
-    if (!serv->gui_client || !serv->gui_client->client) {
-        printf("[DEBUG] No GUI client connected, cannot send take info\n");
-        return;
-    }
     snprintf(response, sizeof(response), "pgt #%d %d\n", player_id,
         resource_type);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    send_gui_message(serv, response, strlen(response));
 }
 
 void take(game_info_t *game_info, linked_client_t *player,
@@ -135,10 +120,10 @@ void take(game_info_t *game_info, linked_client_t *player,
         return;
     }
     resource_type = get_resource_type(args);
-    print_take(player, args, block);
     if (!validate_take_request(player, block, resource_type))
         return;
     remove_resource_from_block(block, resource_type);
+    touch_tile(&game_info->map, pos);
     add_resource_to_player(&player->player->inventory, resource_type);
     send_responce(player->client->client_fd, "ok\n");
     send_take_gui_info(serv, player->player->id, resource_type);
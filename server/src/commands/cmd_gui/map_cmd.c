@@ -7,6 +7,7 @@
 
 #include "commands.h"
 #include "player.h"
+#include "net_backend.h"
 
 void map_size(game_info_t *game_info, server_t *serv, char **args)
 {
@@ -15,7 +16,7 @@ void map_size(game_info_t *game_info, server_t *serv, char **args)
     (void)args;
     snprintf(response, sizeof(response), "msz %d %d\n",
         game_info->map.width, game_info->map.height);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 static void send_block_response(server_t *serv, int x, int y,
@@ -32,7 +33,7 @@ static void send_block_response(server_t *serv, int x, int y,
         block->mendiane,
         block->phiras,
         block->thystame);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 void block_content(game_info_t *game_info, server_t *serv, char **args)
@@ -44,7 +45,7 @@ void block_content(game_info_t *game_info, server_t *serv, char **args)
         sscanf(args[0], "%d", &x) != 1 || sscanf(args[1], "%d", &y) != 1 ||
         x < 0 || x >= game_info->map.width || y < 0 ||
         y >= game_info->map.height) {
-        send(serv->gui_client->client->client_fd, "bct\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "bct\n", 4);
         return;
     }
     send_block_response(serv, x, y, &game_info->map.block[y][x]);
@@ -77,7 +78,7 @@ static void process_map_row(game_info_t *game_info, server_t *serv, int y,
     for (int x = 0; x < game_info->map.width; x++) {
         remaining = 16826 - len;
         if (remaining < 50) {
-            send(serv->gui_client->client->client_fd, response, len, 0);
+            net_send(serv->gui_client->client->client_fd, response, len);
             response[0] = '\0';
             len = 0;
             remaining = 16826;
@@ -102,7 +103,7 @@ void map_content(game_info_t *game_info, server_t *serv, char **args)
     }
     len = strlen(response);
     if (len > 0) {
-        send(serv->gui_client->client->client_fd, response, len, 0);
+        net_send(serv->gui_client->client->client_fd, response, len);
     }
 }
 
@@ -113,7 +114,7 @@ static void add_team_to_response(server_t *serv, linked_teams_t *team,
 
     remaining = 256 - *len;
     if (remaining < strlen(team->name_team) + 10) {
-        send(serv->gui_client->client->client_fd, response, *len, 0);
+        net_send(serv->gui_client->client->client_fd, response, *len);
         *len = 0;
     }
     *len += snprintf(response + *len, 256 - *len,
@@ -129,15 +130,11 @@ void team_names(game_info_t *game_info, server_t *serv, char **args)
     (void)game_info;
     (void)args;
     while (current_team) {
-        if (strcmp(current_team->name_team, "waiting_clients") == 0) {
-            current_team = current_team->next;
-            continue;
-        }
         add_team_to_response(serv, current_team, response, &len);
         current_team = current_team->next;
     }
     if (len > 0)
-        send(serv->gui_client->client->client_fd, response, len, 0);
+        net_send(serv->gui_client->client->client_fd, response, len);
 }
 
 static player_t *search_player_in_team(linked_client_t *client, int player_id)
@@ -157,10 +154,6 @@ player_t *get_player_by_id(linked_teams_t *head_team, int player_id)
     player_t *found_player;
 
     while (team) {
-        if (strcmp(team->name_team, "waiting_clients") == 0) {
-            team = team->next;
-            continue;
-        }
         found_player = search_player_in_team(team->head_client, player_id);
         if (found_player) {
             return found_player;
@@ -7,6 +7,7 @@
 
 #include "commands.h"
 #include "player.h"
+#include "net_backend.h"
 
 void player_pos(game_info_t *game_info, server_t *serv, char **args)
 {
@@ -16,17 +17,17 @@ void player_pos(game_info_t *game_info, server_t *serv, char **args)
 
     (void)game_info;
     if (!args[0] || sscanf(args[0], "#%d", &player_id) != 1 || player_id < 0) {
-        send(serv->gui_client->client->client_fd, "ppo\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "ppo\n", 4);
         return;
     }
     player = get_player_by_id(serv->head_team, player_id);
     if (!player) {
-        send(serv->gui_client->client->client_fd, "ppo\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "ppo\n", 4);
         return;
     }
     snprintf(response, sizeof(response), "ppo #%d %d %d %d\n",
         player_id, player->coords.x, player->coords.y, player->direction);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 void player_level(game_info_t *game_info, server_t *serv, char **args)
@@ -37,17 +38,17 @@ void player_level(game_info_t *game_info, server_t *serv, char **args)
 
     (void)game_info;
     if (!args[0] || sscanf(args[0], "#%d", &player_id) != 1 || player_id < 0) {
-        send(serv->gui_client->client->client_fd, "plv\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "plv\n", 4);
         return;
     }
     player = get_player_by_id(serv->head_team, player_id);
     if (!player) {
-        send(serv->gui_client->client->client_fd, "plv\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "plv\n", 4);
         return;
     }
     snprintf(response, sizeof(response), "plv #%d %d\n", player_id,
         player->level);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 static void send_player_inventory_response(server_t *serv, int player_id,
@@ -70,7 +71,7 @@ static void send_player_inventory_response(server_t *serv, int player_id,
         player->inventory.mendiane,
         player->inventory.phiras,
         player->inventory.thystame);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
 void player_inventory(game_info_t *game_info, server_t *serv, char **args)
@@ -85,12 +86,12 @@ void player_inventory(game_info_t *game_info, server_t *serv, char **args)
     if (!args || !args[0] || sscanf(args[0], "#%d", &player_id) != 1 ||
         player_id < 0 ||
         player_id >= game_info->map.width * game_info->map.height) {
-        send(serv->gui_client->client->client_fd, "pin\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "pin\n", 4);
         return;
     }
     player = get_player_by_id(serv->head_team, player_id);
     if (!player) {
-        send(serv->gui_client->client->client_fd, "pin\n", 4, 0);
+        net_send(serv->gui_client->client->client_fd, "pin\n", 4);
         return;
     }
     send_player_inventory_response(serv, player_id, player);
@@ -103,5 +104,5 @@ void sgt_time(game_info_t *game_info, server_t *serv, char **args)
     (void)game_info;
     (void)args;
     snprintf(response, sizeof(response), "sgt %d\n", 4);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** exec_ready_cmd.c
+** File description:
+** run the completed commands phase by phase, bands in parallel
+*/
+
+#include "commands.h"
+#include "tick_pool.h"
+
+void run_band_commands(tick_pool_t *pool, int band)
+{
+    gui_out_t *out = &pool->gui_out[band];
+    ready_cmd_t *entry;
+
+    set_tick_gui_out(out);
+    for (size_t i = 0; i < pool->nb_ready; i++) {
+        entry = &pool->ready[i];
+        if (entry->band != band || entry->phase != pool->phase)
+            continue;
+        entry->gui_start = out->len;
+        run_ready_command(entry->client, pool->game_info, entry->cmd,
+            pool->serv);
+        entry->gui_len = out->len - entry->gui_start;
+    }
+    set_tick_gui_out(NULL);
+}
+
+static void run_serial_commands(tick_pool_t *pool)
+{
+    ready_cmd_t *entry;
+
+    pool->phase = PHASE_SERIAL;
+    for (size_t i = 0; i < pool->nb_ready; i++) {
+        entry = &pool->ready[i];
+        if (entry->phase == PHASE_SERIAL)
+            run_ready_command(entry->client, pool->game_info, entry->cmd,
+                pool->serv);
+    }
+}
+
+void execute_ready_commands(server_t *serv, game_info_t *game_info)
+{
+    tick_pool_t *pool = serv->pool;
+
+    if (pool->nb_ready == 0)
+        return;
+    plan_wakeup_at(game_info, 0);
+    pool->serv = serv;
+    pool->game_info = game_info;
+    run_tick_phase(pool, PHASE_READ);
+    flush_tick_gui_out(pool);
+    run_tick_phase(pool, PHASE_LOCAL);
+    flush_tick_gui_out(pool);
+    run_serial_commands(pool);
+    pool->nb_ready = 0;
+    for (int phase = PHASE_READ; phase <= PHASE_SERIAL; phase++)
+        pool->nb_phase[phase] = 0;
+}
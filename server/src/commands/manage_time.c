@@ -21,22 +21,43 @@ void get_current_time(struct timespec *ts)
     clock_gettime(CLOCK_MONOTONIC, ts);
 }
 
+static void advance_time(struct timespec *ts, double seconds)
+{
+    long ns = (long)(seconds * 1000000000.0);
+
+    ts->tv_sec += ns / 1000000000;
+    ts->tv_nsec += ns % 1000000000;
+    if (ts->tv_nsec >= 1000000000) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
+
+static void starve_player(linked_client_t *player, game_info_t *game_info)
+{
+    leave_tile(&game_info->map, player);
+    player->player->state = DEAD;
+    push_dead_player(game_info, player);
+}
+
 void eat_food(linked_client_t *player, game_info_t *game_info)
 {
     struct timespec current_time;
+    double period = 126.0 / game_info->freq;
     double wt;
 
     get_current_time(&current_time);
     wt = timespec_diff(&player->player->time_eat, &current_time);
-    if (wt >= (126.0 / game_info->freq)) {
+    while (wt >= period && player->player->state == ALIVE) {
         printf("[DEBUG] Player fd=%d and wt : %f is eating food\n",
             player->client->client_fd, wt);
         player->player->inventory.food--;
-        get_current_time(&player->player->time_eat);
-        if (player->player->inventory.food < 0) {
-            player->player->state = DEAD;
-        }
+        advance_time(&player->player->time_eat, period);
+        wt -= period;
+        if (player->player->inventory.food < 0)
+            starve_player(player, game_info);
     }
+    plan_wakeup(game_info, &player->player->time_eat, period);
 }
 
 void verif_regen_ressources(game_info_t *game_info)
@@ -51,4 +72,5 @@ void verif_regen_ressources(game_info_t *game_info)
         generate_res_map(game_info);
         get_current_time(&game_info->time_gen);
     }
+    plan_wakeup(game_info, &game_info->time_gen, 20.0 / game_info->freq);
 }
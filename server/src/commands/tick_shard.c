@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** tick_shard.c
+** File description:
+** sort completed commands into read, band local and serial phases
+*/
+
+#include "commands.h"
+#include "tick_pool.h"
+
+int get_band_of_row(int y, int height, int nb_bands)
+{
+    if (height <= 0 || nb_bands <= 1)
+        return 0;
+    return (int)(((long)y * nb_bands) / height);
+}
+
+static bool forward_stays_in_band(player_t *player, game_info_t *game_info,
+    int nb_bands)
+{
+    int height = game_info->map.height;
+    int y = player->coords.y;
+
+    if (player->direction == UP)
+        y = (y + 1) % height;
+    if (player->direction == DOWN)
+        y = (y - 1 + height) % height;
+    return get_band_of_row(y, height, nb_bands) ==
+        get_band_of_row(player->coords.y, height, nb_bands);
+}
+
+static const phase_cmd_ai_t *get_phase_info(command_ai_t *cmd)
+{
+    static const phase_cmd_ai_t unknown = {PHASE_SERIAL, false};
+
+    if (cmd->index < 0 || cmd->index >= (int)(sizeof(tab_phase_ai) /
+        sizeof(tab_phase_ai[0])))
+        return &unknown;
+    return &tab_phase_ai[cmd->index];
+}
+
+static bool grow_ready_array(tick_pool_t *pool)
+{
+    ready_cmd_t *ready;
+    size_t new_cap;
+
+    if (pool->nb_ready < pool->cap_ready)
+        return true;
+    new_cap = (pool->cap_ready == 0) ? 64 : pool->cap_ready * 2;
+    ready = realloc(pool->ready, sizeof(ready_cmd_t) * new_cap);
+    if (!ready) {
+        perror("realloc");
+        return false;
+    }
+    pool->ready = ready;
+    pool->cap_ready = new_cap;
+    return true;
+}
+
+void push_ready_command(tick_pool_t *pool, linked_client_t *client,
+    command_ai_t *cmd, game_info_t *game_info)
+{
+    const phase_cmd_ai_t *info = get_phase_info(cmd);
+    ready_cmd_t *entry;
+
+    if (!grow_ready_array(pool))
+        return;
+    entry = &pool->ready[pool->nb_ready];
+    entry->client = client;
+    entry->cmd = cmd;
+    entry->band = get_band_of_row(client->player->coords.y,
+        game_info->map.height, pool->nb_bands);
+    // Moves leaving their band run after the bands, still in list order
+    if (info->moves &&
+        !forward_stays_in_band(client->player, game_info, pool->nb_bands))
+        entry->band = pool->nb_bands;
+    entry->phase = info->phase;
+    entry->gui_start = 0;
+    entry->gui_len = 0;
+    pool->nb_phase[entry->phase]++;
+    pool->nb_ready++;
+}
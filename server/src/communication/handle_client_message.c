@@ -6,6 +6,9 @@
 */
 
 #include "socket.h"
+#include "map.h"
+#include "team_slots.h"
+#include "net_backend.h"
 #include "errno.h"
 
 static int handle_recv_error(int ret, client_t *client)
@@ -33,7 +36,7 @@ int receive_into_circbuf(client_t *client)
     to_read = space;
     if (to_read > end_space)
         to_read = end_space;
-    ret = recv(client->client_fd, &cb->data[cb->head], to_read, 0);
+    ret = net_recv(client->client_fd, &cb->data[cb->head], to_read);
     if (ret <= 0)
         return handle_recv_error(ret, client);
     cb->head = (cb->head + ret) % CIRCBUF_SIZE;
@@ -44,16 +47,12 @@ int receive_into_circbuf(client_t *client)
 void remove_client_struct(client_t *client)
 {
     if (client) {
-        if (client->pollfd) {
-            client->pollfd->fd = -1;
-            client->pollfd->events = 0;
-            client->pollfd->revents = 0;
-        }
+        release_pollfd(client->pollfd);
         if (client->client_fd != -1) {
-            close(client->client_fd);
+            net_close(client->client_fd);
             client->client_fd = -1;
         }
-        memset(&client->circbuf, 0, sizeof(circbuf_t));
+        free(client);
     }
 }
 
@@ -67,15 +66,23 @@ static void reset_player(player_t *player)
         player->coords.y = 0;
         player->direction = UP;
         init_inventory(&player->inventory);
+        player->level = 1;
         player->state = UNUSED;
         player->is_waiting_start = false;
     }
 }
 
-void remove_linked_client(linked_client_t *head)
+void remove_linked_client(server_t *serv, linked_client_t *head)
 {
+    detach_from_incantation(head);
     remove_client_struct(head->client);
+    if (head->player)
+        remove_max_level_player(serv, head->player);
+    if (head->player && serv->map)
+        leave_tile(serv->map, head);
     reset_player(head->player);
+    if (head->player && head->player->team)
+        add_unused_slot(head->player->team, head);
     head->client = NULL;
 }
 
@@ -96,12 +103,12 @@ void handle_client_message(server_t *serv, linked_client_t *client)
     if (is_client_disconnected(client->client)) {
         printf("Client fd=%d is already disconnected\n",
         client->client->client_fd);
-        remove_linked_client(client);
+        remove_linked_client(serv, client);
         return;
     }
     ret = receive_into_circbuf(client->client);
     if (ret <= 0) {
-        remove_linked_client(client);
+        remove_linked_client(serv, client);
         return;
     }
     printf("Received %d bytes from fd=%d\n", ret, client->client->client_fd);
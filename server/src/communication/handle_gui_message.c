@@ -17,7 +17,7 @@ void handle_parse_result_gui(int result,
     } else if (result == -2) {
         printf("[WARNING] Command too long from fd=%d, discarded\n",
             client->client->client_fd);
-    } else {
+    } else if (result == -1) {
         printf("[ERROR] Inconsistent state: "
             "has_complete_command true but read failed\n");
     }
@@ -33,9 +33,10 @@ void parse_gui_command(server_t *serv, gui_t *client)
     while (has_complete_command(cb)) {
         result = read_command_from_buffer(cb, command, sizeof(command));
         handle_parse_result_gui(result, client, command);
-        if (result <= 0)
+        if (result == -1)
             break;
-        parse_line_command_gui(client, command);
+        if (result > 0)
+            parse_line_command_gui(client, command);
     }
 }
 
@@ -5,71 +5,18 @@
 ** fct that handle new connection of client
 */
 
+#define _GNU_SOURCE
 #include "socket.h"
+#include "game_info.h"
+#include "net_backend.h"
+#include "games.h"
+#include <errno.h>
 #include <stdlib.h>
-#include <fcntl.h>
-
-static linked_client_t *create_linked_client(client_t *new_client)
-{
-    linked_client_t *new_linked_client = malloc(sizeof(linked_client_t));
-
-    if (new_linked_client == NULL)
-        return NULL;
-    new_linked_client->client = new_client;
-    new_linked_client->player = NULL;
-    new_linked_client->next = NULL;
-    return new_linked_client;
-}
-
-static int add_client_to_team(linked_teams_t *team, client_t *new_client)
-{
-    linked_client_t *new_linked_client = create_linked_client(new_client);
-
-    if (new_linked_client == NULL)
-        return 84;
-    new_linked_client->after_connect = false;
-    new_linked_client->next = team->head_client;
-    team->head_client = new_linked_client;
-    return 0;
-}
-
-static int register_client(server_t *serv, client_t *new_client)
-{
-    linked_teams_t *tmp = serv->head_team;
-
-    while (tmp != NULL) {
-        if (strcmp(tmp->name_team, "waiting_clients") == 0) {
-            return add_client_to_team(tmp, new_client);
-        }
-        tmp = tmp->next;
-    }
-    return 84;
-}
-
-static int find_free_pollfd_index(server_t *serv)
-{
-    for (int i = 1; i <= MAX_CLIENTS; i++) {
-        if (serv->pollfds[i].fd == -1 || serv->pollfds[i].fd == 0) {
-            return i;
-        }
-    }
-    return -1;
-}
 
 static void init_client(server_t *serv, client_t *client, int fd,
-    struct sockaddr_in *addr)
+    int pollfd_index)
 {
-    int pollfd_index = find_free_pollfd_index(serv);
-
-    if (pollfd_index == -1) {
-        fprintf(stderr, "Error: No free pollfd slot available\n");
-        close(fd);
-        free(client);
-        return;
-    }
-    fcntl(fd, F_SETFL, O_NONBLOCK);
     client->client_fd = fd;
-    client->client_adr = *addr;
     serv->pollfds[pollfd_index].fd = fd;
     serv->pollfds[pollfd_index].events = POLLIN;
     serv->pollfds[pollfd_index].revents = 0;
@@ -78,44 +25,80 @@ static void init_client(server_t *serv, client_t *client, int fd,
     client->circbuf.tail = 0;
     client->circbuf.len = 0;
     serv->nb_clients++;
+    net_watch(serv, pollfd_index);
 }
 
-static void send_welcome_message(int client_fd)
+static client_t *add_client(server_t *serv, int fd,
+    struct sockaddr_in *addr)
 {
-    if (send(client_fd, "WELCOME\n", 8, 0) < 0) {
-        perror("send welcome");
+    client_t *new_client;
+
+    if (serv->nb_free_slots == 0) {
+        printf("Maximum clients reached, rejecting connection\n");
+        close(fd);
+        return NULL;
+    }
+    new_client = malloc(sizeof(client_t));
+    if (!new_client) {
+        perror("malloc");
+        close(fd);
+        return NULL;
     }
+    new_client->client_adr = *addr;
+    init_client(serv, new_client, fd, acquire_pollfd_slot(serv));
+    if (!add_waiting_client(serv, new_client)) {
+        handle_disconnected_client(new_client);
+        return NULL;
+    }
+    return new_client;
 }
 
-static int try_accept_client(server_t *serv, struct sockaddr_in *addr,
-    socklen_t *len)
+static void adopt_routed_clients(server_t *serv)
 {
-    int fd = accept(serv->sock.socket_fd, (struct sockaddr *)addr,
-        len);
+    game_handoff_t handoff;
+    client_t *client;
+    circbuf_t *cb;
+
+    while (pop_game_inbox(serv->inbox, &handoff)) {
+        client = add_client(serv, handoff.fd, &handoff.addr);
+        if (!client)
+            continue;
+        cb = &client->circbuf;
+        memcpy(cb->data, handoff.line, handoff.len);
+        cb->head = handoff.len;
+        cb->len = handoff.len;
+        // The team line came with the socket, no POLLIN will announce it
+        add_ready_slot(serv, client->pollfd - serv->pollfds);
+    }
+}
 
-    if (fd < 0)
-        perror("accept");
-    return fd;
+static bool should_retry_accept(void)
+{
+    if (errno == EINTR || errno == ECONNABORTED)
+        return true;
+    if (errno != EAGAIN && errno != EWOULDBLOCK)
+        perror("accept4");
+    return false;
 }
 
 void manage_client_connect(server_t *serv)
 {
     struct sockaddr_in client_addr;
-    socklen_t addr_len = sizeof(client_addr);
-    client_t *new_client;
+    socklen_t addr_len;
     int clifd;
 
-    if (serv->nb_clients >= MAX_CLIENTS) {
-        printf("Maximum clients reached, rejecting connection\n");
+    if (serv->inbox) {
+        adopt_routed_clients(serv);
         return;
     }
-    new_client = malloc(sizeof(client_t));
-    clifd = try_accept_client(serv, &client_addr, &addr_len);
-    if (clifd < 0) {
-        free(new_client);
-        return;
+    while (true) {
+        addr_len = sizeof(client_addr);
+        clifd = accept4(serv->sock.socket_fd,
+            (struct sockaddr *)&client_addr, &addr_len,
+            SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (clifd < 0 && !should_retry_accept())
+            return;
+        if (clifd >= 0 && add_client(serv, clifd, &client_addr))
+            net_send(clifd, "WELCOME\n", 8);
     }
-    send_welcome_message(clifd);
-    init_client(serv, new_client, clifd, &client_addr);
-    register_client(serv, new_client);
 }
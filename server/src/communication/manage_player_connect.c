@@ -8,72 +8,45 @@
 #include "game_info.h"
 #include "socket.h"
 #include "player.h"
+#include "net_backend.h"
 #include "errno.h"
 #include <time.h>
 
 bool is_valid_team(server_t *serv, const char *team_name)
 {
-    linked_teams_t *tmp = serv->head_team;
+    linked_teams_t *team = get_team(serv, team_name);
 
-    while (tmp) {
-        if (strcmp(tmp->name_team, "waiting_clients") != 0 &&
-            strcmp(tmp->name_team, team_name) == 0 &&
-            tmp->nbr_max_player > 0)
-            return true;
-        tmp = tmp->next;
-    }
-    return false;
+    return team != NULL && team->nbr_max_player > 0;
 }
 
-linked_teams_t *get_team(server_t *serv, const char *team_name)
+bool receive_waiting_input(client_t *client)
 {
-    linked_teams_t *tmp = serv->head_team;
+    int ret;
 
-    while (tmp) {
-        if (strcmp(tmp->name_team, team_name) == 0)
-            return tmp;
-        tmp = tmp->next;
-    }
-    return NULL;
+    if (!client->pollfd ||
+        !(client->pollfd->revents & (POLLIN | POLLHUP | POLLERR)))
+        return true;
+    ret = receive_into_circbuf(client);
+    if (ret == 84)
+        return has_complete_command(&client->circbuf);
+    return ret > 0 || (ret < 0 && (errno == EAGAIN || errno == EINTR));
 }
 
-static char *extract_team_name(const char *buf)
+int get_client_message(client_t *client, char *dest, size_t size)
 {
-    char *team = strdup(buf);
-    size_t i = 0;
-
-    if (!team)
-        return NULL;
-    while (team[i]) {
-        if (team[i] == '\r' || team[i] == '\n') {
-            team[i] = '\0';
-            break;
-        }
-        i++;
-    }
-    return team;
+    return read_command_from_buffer(&client->circbuf, dest, size);
 }
 
-char *get_client_message(linked_client_t *client)
+void setup_player_position(linked_client_t *slot, game_info_t *game_info)
 {
-    char buf[1024] = {0};
-    int ret;
-
-    if (!client || !client->client || client->client->client_fd < 0)
-        return NULL;
-    ret = recv(client->client->client_fd, buf, sizeof(buf) - 1, MSG_DONTWAIT);
-    if (ret <= 0)
-        return NULL;
-    return extract_team_name(buf);
-}
+    player_t *player = slot->player;
 
-void setup_player_position(player_t *player, game_info_t *game_info)
-{
     if (player->state != EGG) {
         player->coords.x = rand() % game_info->map.width;
         player->coords.y = rand() % game_info->map.height;
     }
     player->state = ALIVE;
+    enter_tile(&game_info->map, slot);
     get_current_time(&player->time_eat);
     printf("[DEBUG] Player %d positioned at (%d, %d) and set to ALIVE\n",
         player->id, player->coords.x, player->coords.y);
@@ -83,5 +56,5 @@ void manage_player_connect(server_t *serv, game_info_t *game_info)
 {
     if (!serv || !game_info)
         return;
-    process_all_waiting_clients(serv, game_info);
+    process_ready_waiting_clients(serv, game_info);
 }
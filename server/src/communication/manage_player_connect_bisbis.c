@@ -9,13 +9,14 @@
 #include "socket.h"
 #include "player.h"
 #include "errno.h"
+#include "net_backend.h"
 #include <time.h>
 
 void assign_client_to_slot(linked_client_t *slot,
-    linked_client_t *waiting_client, game_info_t *game_info)
+    client_t *waiting_client, game_info_t *game_info)
 {
-    slot->client = waiting_client->client;
-    setup_player_position(slot->player, game_info);
+    slot->client = waiting_client;
+    setup_player_position(slot, game_info);
     slot->after_connect = true;
     slot->player->is_incantation = false;
     printf("[DEBUG] Client fd=%d assigned to player %d\n",
@@ -34,7 +35,7 @@ void new_connection_player_gui(player_t *player, server_t *serv)
     snprintf(response, sizeof(response), "pnw #%d %d %d %d %d %s\n",
         player->id, player->coords.x, player->coords.y,
         player->direction, player->level, player->team_name);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
     printf("[DEBUG] New player GUI response sent for player %d\n", player->id);
 }
 
@@ -46,31 +47,44 @@ void send_connection_response(int fd, bool success, int remaining_slots,
     if (success && player) {
         snprintf(response, sizeof(response), "%d\n%d %d\n",
             remaining_slots, player->coords.x, player->coords.y);
-        send(fd, response, strlen(response), 0);
+        net_send(fd, response, strlen(response));
     } else {
-        send(fd, "ko\n", 3, 0);
+        net_send(fd, "ko\n", 3);
     }
 }
 
-void remove_client_from_list(linked_teams_t *waiting,
-    linked_client_t *target, linked_client_t *prev)
+static long waiting_slot(server_t *serv, client_t *client)
 {
-    if (prev)
-        prev->next = target->next;
-    else
-        waiting->head_client = target->next;
-    free(target);
+    long slot = client->pollfd ? client->pollfd - serv->pollfds : -1;
+
+    return (slot > 0 && slot <= MAX_CLIENTS) ? slot : -1;
+}
+
+bool add_waiting_client(server_t *serv, client_t *client)
+{
+    long slot = waiting_slot(serv, client);
+
+    if (slot < 0)
+        return false;
+    serv->waiting[slot] = client;
+    serv->nb_waiting++;
+    return true;
 }
 
-void process_all_waiting_clients(server_t *serv, game_info_t *game_info)
+// Only the sockets of the ready set can have a new line to parse
+void process_ready_waiting_clients(server_t *serv, game_info_t *game_info)
 {
-    linked_teams_t *waiting = get_team(serv, "waiting_clients");
-    linked_client_t *curr = waiting->head_client;
-    linked_client_t *next;
+    client_t *client;
+    int slot;
 
-    while (curr) {
-        next = curr->next;
-        process_waiting_client(serv, curr, game_info);
-        curr = next;
+    for (int i = 0; i < serv->nb_ready && serv->nb_waiting > 0; i++) {
+        slot = serv->ready_slots[i];
+        if (slot <= 0 || slot > MAX_CLIENTS)
+            continue;
+        client = serv->waiting[slot];
+        if (client && process_waiting_client(serv, client, game_info)) {
+            serv->waiting[slot] = NULL;
+            serv->nb_waiting--;
+        }
     }
 }
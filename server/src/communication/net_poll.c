@@ -0,0 +1,37 @@
+/*
+** EPITECH PROJECT, 2025
+** net_poll.c
+** File description:
+** poll backend of the server loop, every socket call is done directly
+*/
+
+#define _GNU_SOURCE
+#include "net_backend.h"
+#include <poll.h>
+
+int net_backend_init(server_t *serv)
+{
+    (void)serv;
+    return 0;
+}
+
+void net_backend_destroy(void)
+{
+}
+
+int net_wait(server_t *serv, long timeout_us)
+{
+    struct timespec ts = {timeout_us / 1000000, (timeout_us % 1000000) * 1000};
+
+    return ppoll(serv->pollfds, NB_POLLFDS, &ts, NULL);
+}
+
+void net_watch(server_t *serv, int slot)
+{
+    (void)serv;
+    (void)slot;
+}
+
+void net_flush(void)
+{
+}
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2025
+** net_poll_io.c
+** File description:
+** recv, send and close of the poll backend
+*/
+
+#include "net_backend.h"
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+
+ssize_t net_recv(int fd, void *buf, size_t len)
+{
+    return recv(fd, buf, len, MSG_DONTWAIT);
+}
+
+bool net_peer_closed(int fd)
+{
+    char test_buf[1];
+    ssize_t ret;
+
+    ret = recv(fd, test_buf, 1, MSG_PEEK | MSG_DONTWAIT);
+    return (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK));
+}
+
+void net_send(int fd, const char *buf, size_t len)
+{
+    send(fd, buf, len, MSG_NOSIGNAL);
+}
+
+void net_close(int fd)
+{
+    close(fd);
+}
+
+size_t net_pending(int fd)
+{
+    int value = 0;
+
+    if (ioctl(fd, SIOCOUTQ, &value) < 0 || value < 0)
+        return 0;
+    return (size_t)value;
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring.c
+** File description:
+** io_uring backend of the server loop, one submission per loop iteration
+*/
+
+#include "net_uring.h"
+
+static net_uring_t **get_instance_ptr(void)
+{
+    static net_uring_t *instance = NULL;
+
+    return &instance;
+}
+
+net_uring_t *get_net_uring(void)
+{
+    return *get_instance_ptr();
+}
+
+static bool is_single_game(server_t *serv)
+{
+    if (serv->inbox == NULL)
+        return true;
+    fprintf(stderr, "Error: the io_uring backend hosts a single game, "
+        "rebuild the server without IO_URING=1 to use -g.\n");
+    return false;
+}
+
+int net_backend_init(server_t *serv)
+{
+    net_uring_t *ring;
+
+    if (!is_single_game(serv))
+        return -1;
+    ring = calloc(1, sizeof(net_uring_t));
+    if (!ring) {
+        perror("calloc");
+        return -1;
+    }
+    ring->serv = serv;
+    if (net_uring_setup(ring) != 0) {
+        fprintf(stderr, "Error: io_uring is not available, "
+            "rebuild the server without IO_URING=1.\n");
+        net_uring_teardown(ring);
+        free(ring);
+        return -1;
+    }
+    *get_instance_ptr() = ring;
+    return 0;
+}
+
+void net_backend_destroy(void)
+{
+    net_uring_t *ring = get_net_uring();
+
+    if (!ring)
+        return;
+    for (int fd = 0; fd < NET_MAX_FD; fd++) {
+        if (ring->conns[fd]) {
+            net_buf_free(&ring->conns[fd]->in);
+            net_buf_free(&ring->conns[fd]->out);
+            net_buf_free(&ring->conns[fd]->inflight);
+            free(ring->conns[fd]);
+        }
+    }
+    net_uring_teardown(ring);
+    free(ring);
+    *get_instance_ptr() = NULL;
+}
+
+static int mark_readable_slots(net_uring_t *ring, server_t *serv)
+{
+    net_conn_t *conn;
+    int ready = 0;
+    int fd;
+
+    for (int i = 0; i < NB_POLLFDS; i++) {
+        fd = serv->pollfds[i].fd;
+        conn = (fd >= 0 && fd < NET_MAX_FD) ? ring->conns[fd] : NULL;
+        if (conn && (conn->in.len > 0 || conn->eof))
+            serv->pollfds[i].revents |= POLLIN;
+        if (fd >= 0 && serv->pollfds[i].revents != 0)
+            ready++;
+    }
+    return ready;
+}
+
+int net_wait(server_t *serv, long timeout_us)
+{
+    net_uring_t *ring = get_net_uring();
+    int ready = mark_readable_slots(ring, serv);
+
+    if (!ring->accept_armed)
+        net_uring_arm_accept(ring);
+    net_uring_arm_polls(ring, serv);
+    if (net_uring_enter(ring, (ready > 0) ? 0 : 1, timeout_us) < 0)
+        return -1;
+    net_uring_reap(ring);
+    return mark_readable_slots(ring, serv);
+}
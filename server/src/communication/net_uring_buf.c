@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_buf.c
+** File description:
+** growable byte buffers holding the inbound and outbound data of a socket
+*/
+
+#include "net_uring.h"
+
+bool net_buf_append(net_buf_t *buf, const char *data, size_t len)
+{
+    size_t new_cap = (buf->cap == 0) ? NET_BUF_SIZE : buf->cap;
+    char *new_data;
+
+    while (new_cap < buf->len + len)
+        new_cap *= 2;
+    if (new_cap != buf->cap) {
+        new_data = realloc(buf->data, new_cap);
+        if (!new_data) {
+            perror("realloc");
+            return false;
+        }
+        buf->data = new_data;
+        buf->cap = new_cap;
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+    return true;
+}
+
+void net_buf_consume(net_buf_t *buf, size_t len)
+{
+    if (len >= buf->len) {
+        buf->len = 0;
+        return;
+    }
+    memmove(buf->data, buf->data + len, buf->len - len);
+    buf->len -= len;
+}
+
+void net_buf_free(net_buf_t *buf)
+{
+    free(buf->data);
+    buf->data = NULL;
+    buf->len = 0;
+    buf->cap = 0;
+}
+
+void net_uring_mark_dirty(net_uring_t *ring, int fd, net_conn_t *conn)
+{
+    if (conn->dirty || ring->nb_dirty >= NET_MAX_FD)
+        return;
+    conn->dirty = true;
+    ring->dirty[ring->nb_dirty] = fd;
+    ring->nb_dirty++;
+}
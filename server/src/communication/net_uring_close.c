@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_close.c
+** File description:
+** close of a socket owned by the io_uring backend
+*/
+
+#include "net_uring.h"
+
+static void drain_pending_sends(net_uring_t *ring, int fd, net_conn_t *conn)
+{
+    for (int i = 0; i < NET_CLOSE_TRIES; i++) {
+        if (!conn->sending && conn->inflight.len == 0 && conn->out.len == 0)
+            break;
+        if (!conn->sending)
+            net_uring_post_send(ring, fd, conn);
+        if (net_uring_enter(ring, 1, 50) < 0)
+            break;
+        net_uring_reap(ring);
+    }
+    if (conn->sending)
+        return;
+    if (conn->inflight.len > 0)
+        send(fd, conn->inflight.data, conn->inflight.len,
+            MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (conn->out.len > 0)
+        send(fd, conn->out.data, conn->out.len, MSG_NOSIGNAL | MSG_DONTWAIT);
+}
+
+static void cancel_recv(net_uring_t *ring, int fd, net_conn_t *conn)
+{
+    struct io_uring_sqe *sqe = net_uring_get_sqe(ring);
+
+    if (!sqe)
+        return;
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = fd;
+    sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    sqe->user_data = net_uring_data(ring, NET_OP_CANCEL, fd);
+    for (int i = 0; i < NET_CLOSE_TRIES && conn->armed; i++) {
+        conn->eof = true;
+        if (net_uring_enter(ring, 1, 50) < 0)
+            break;
+        net_uring_reap(ring);
+    }
+}
+
+void net_close(int fd)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn = (ring && fd >= 0 && fd < NET_MAX_FD) ?
+        ring->conns[fd] : NULL;
+
+    if (!conn) {
+        if (ring && fd >= 0 && fd < NET_MAX_FD && ring->polled[fd])
+            net_uring_cancel_poll(ring, fd);
+        close(fd);
+        return;
+    }
+    pthread_mutex_lock(&ring->send_lock);
+    drain_pending_sends(ring, fd, conn);
+    cancel_recv(ring, fd, conn);
+    ring->gen[fd]++;
+    ring->conns[fd] = NULL;
+    pthread_mutex_unlock(&ring->send_lock);
+    net_buf_free(&conn->in);
+    net_buf_free(&conn->out);
+    if (!conn->sending)
+        net_buf_free(&conn->inflight);
+    free(conn);
+    close(fd);
+}
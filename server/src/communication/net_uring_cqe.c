@@ -0,0 +1,126 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_cqe.c
+** File description:
+** post the accept, recv and send requests and handle their completions
+*/
+
+#include "net_uring.h"
+#include <errno.h>
+#include <poll.h>
+
+void net_uring_arm_accept(net_uring_t *ring)
+{
+    struct io_uring_sqe *sqe = net_uring_get_sqe(ring);
+    int fd = ring->serv->sock.socket_fd;
+
+    if (!sqe)
+        return;
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = POLLIN;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = net_uring_data(ring, NET_OP_ACCEPT, fd);
+    ring->accept_armed = true;
+}
+
+void net_uring_arm_recv(net_uring_t *ring, int fd)
+{
+    struct io_uring_sqe *sqe = net_uring_get_sqe(ring);
+
+    if (!sqe)
+        return;
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = NET_BGID;
+    sqe->user_data = net_uring_data(ring, NET_OP_RECV, fd);
+    ring->conns[fd]->armed = true;
+}
+
+void net_uring_post_send(net_uring_t *ring, int fd, net_conn_t *conn)
+{
+    struct io_uring_sqe *sqe;
+    net_buf_t tmp;
+
+    if (conn->inflight.len == 0) {
+        tmp = conn->inflight;
+        conn->inflight = conn->out;
+        conn->out = tmp;
+    }
+    sqe = net_uring_get_sqe(ring);
+    if (!sqe) {
+        // Submission queue full, the next net_flush posts it again
+        net_uring_mark_dirty(ring, fd, conn);
+        return;
+    }
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)conn->inflight.data;
+    sqe->len = conn->inflight.len;
+    sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+    sqe->user_data = net_uring_data(ring, NET_OP_SEND, fd);
+    conn->sending = true;
+}
+
+static void handle_recv(net_uring_t *ring, struct io_uring_cqe *cqe,
+    int fd, net_conn_t *conn)
+{
+    unsigned short bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+
+    if (cqe->flags & IORING_CQE_F_BUFFER) {
+        if (conn && cqe->res > 0)
+            net_buf_append(&conn->in, ring->buf_pool +
+                (size_t)bid * NET_BUF_SIZE, cqe->res);
+        net_uring_recycle(ring, bid);
+    }
+    if (!conn)
+        return;
+    if (cqe->res == 0 || (cqe->res < 0 && cqe->res != -ENOBUFS &&
+        cqe->res != -ECANCELED))
+        conn->eof = true;
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        conn->armed = false;
+        if (!conn->eof && cqe->res != -ECANCELED)
+            net_uring_arm_recv(ring, fd);
+    }
+}
+
+static void handle_send(net_uring_t *ring, struct io_uring_cqe *cqe,
+    int fd, net_conn_t *conn)
+{
+    if (!conn)
+        return;
+    conn->sending = false;
+    if (cqe->res < 0) {
+        conn->inflight.len = 0;
+        conn->out.len = 0;
+        return;
+    }
+    net_buf_consume(&conn->inflight, cqe->res);
+    if (conn->inflight.len > 0 || conn->out.len > 0)
+        net_uring_mark_dirty(ring, fd, conn);
+}
+
+void net_uring_handle_cqe(net_uring_t *ring, struct io_uring_cqe *cqe)
+{
+    net_op_t op = (net_op_t)(cqe->user_data >> NET_OP_SHIFT);
+    int fd = (int)(uint32_t)cqe->user_data;
+    uint32_t gen = (cqe->user_data >> NET_GEN_SHIFT) & 0xffffff;
+    bool current = fd >= 0 && fd < NET_MAX_FD &&
+        (ring->gen[fd] & 0xffffff) == gen;
+    net_conn_t *conn = current ? ring->conns[fd] : NULL;
+
+    if (op == NET_OP_RECV)
+        handle_recv(ring, cqe, fd, conn);
+    if (op == NET_OP_SEND)
+        handle_send(ring, cqe, fd, conn);
+    if (op == NET_OP_POLL && current)
+        net_uring_handle_poll(ring, fd, cqe->res);
+    if (op == NET_OP_ACCEPT) {
+        ring->serv->pollfds[0].revents |= POLLIN;
+        if (!(cqe->flags & IORING_CQE_F_MORE))
+            ring->accept_armed = false;
+    }
+}
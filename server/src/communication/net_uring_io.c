@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_io.c
+** File description:
+** recv and send of the io_uring backend, served from per socket buffers
+*/
+
+#include "net_uring.h"
+#include <errno.h>
+
+void net_watch(server_t *serv, int slot)
+{
+    net_uring_t *ring = get_net_uring();
+    int fd = serv->pollfds[slot].fd;
+    net_conn_t *conn;
+
+    if (fd < 0 || fd >= NET_MAX_FD || ring->conns[fd])
+        return;
+    conn = calloc(1, sizeof(net_conn_t));
+    if (!conn) {
+        perror("calloc");
+        return;
+    }
+    conn->slot = slot;
+    ring->conns[fd] = conn;
+    net_uring_arm_recv(ring, fd);
+}
+
+ssize_t net_recv(int fd, void *buf, size_t len)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn = (fd >= 0 && fd < NET_MAX_FD) ? ring->conns[fd] : NULL;
+
+    if (!conn) {
+        errno = EBADF;
+        return -1;
+    }
+    if (conn->in.len == 0) {
+        errno = EAGAIN;
+        return conn->eof ? 0 : -1;
+    }
+    if (len > conn->in.len)
+        len = conn->in.len;
+    memcpy(buf, conn->in.data, len);
+    net_buf_consume(&conn->in, len);
+    return (ssize_t)len;
+}
+
+bool net_peer_closed(int fd)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn = (fd >= 0 && fd < NET_MAX_FD) ? ring->conns[fd] : NULL;
+
+    return (!conn || (conn->in.len == 0 && conn->eof));
+}
+
+void net_send(int fd, const char *buf, size_t len)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn = (fd >= 0 && fd < NET_MAX_FD) ? ring->conns[fd] : NULL;
+
+    if (!conn) {
+        send(fd, buf, len, MSG_NOSIGNAL | MSG_DONTWAIT);
+        return;
+    }
+    pthread_mutex_lock(&ring->send_lock);
+    if (net_buf_append(&conn->out, buf, len))
+        net_uring_mark_dirty(ring, fd, conn);
+    pthread_mutex_unlock(&ring->send_lock);
+}
+
+void net_flush(void)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn;
+    int nb_dirty;
+    int fd;
+
+    pthread_mutex_lock(&ring->send_lock);
+    nb_dirty = ring->nb_dirty;
+    // A send left without SQE marks its fd again, at an index already read
+    ring->nb_dirty = 0;
+    for (int i = 0; i < nb_dirty; i++) {
+        fd = ring->dirty[i];
+        conn = ring->conns[fd];
+        if (!conn)
+            continue;
+        conn->dirty = false;
+        if (conn->sending)
+            continue;
+        if (conn->inflight.len > 0 || conn->out.len > 0)
+            net_uring_post_send(ring, fd, conn);
+    }
+    pthread_mutex_unlock(&ring->send_lock);
+}
+
+size_t net_pending(int fd)
+{
+    net_uring_t *ring = get_net_uring();
+    net_conn_t *conn = (fd >= 0 && fd < NET_MAX_FD) ? ring->conns[fd] : NULL;
+
+    if (!conn)
+        return 0;
+    return conn->out.len + conn->inflight.len;
+}
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_poll.c
+** File description:
+** one-shot polls on the admin sockets, which are read without the ring
+*/
+
+#include "net_uring.h"
+#include <errno.h>
+#include <poll.h>
+
+static void arm_poll(net_uring_t *ring, int fd, short events)
+{
+    struct io_uring_sqe *sqe = net_uring_get_sqe(ring);
+
+    if (!sqe)
+        return;
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = events;
+    sqe->user_data = net_uring_data(ring, NET_OP_POLL, fd);
+    ring->polled[fd] = true;
+}
+
+void net_uring_arm_polls(net_uring_t *ring, server_t *serv)
+{
+    struct pollfd *pfd;
+
+    for (int i = ADMIN_POLLFD; i < NB_POLLFDS; i++) {
+        pfd = &serv->pollfds[i];
+        if (pfd->fd >= 0 && pfd->fd < NET_MAX_FD && !ring->polled[pfd->fd])
+            arm_poll(ring, pfd->fd, pfd->events);
+    }
+}
+
+void net_uring_handle_poll(net_uring_t *ring, int fd, int res)
+{
+    struct pollfd *pfd;
+
+    ring->polled[fd] = false;
+    if (res == -ECANCELED)
+        return;
+    for (int i = ADMIN_POLLFD; i < NB_POLLFDS; i++) {
+        pfd = &ring->serv->pollfds[i];
+        if (pfd->fd == fd)
+            pfd->revents |= (res > 0) ? res : POLLERR;
+    }
+}
+
+void net_uring_cancel_poll(net_uring_t *ring, int fd)
+{
+    struct io_uring_sqe *sqe = net_uring_get_sqe(ring);
+
+    if (sqe) {
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->addr = net_uring_data(ring, NET_OP_POLL, fd);
+        sqe->user_data = net_uring_data(ring, NET_OP_CANCEL, fd);
+    }
+    ring->gen[fd]++;
+    ring->polled[fd] = false;
+}
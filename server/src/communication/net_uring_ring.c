@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_ring.c
+** File description:
+** submission, completion and buffer rings shared with the kernel
+*/
+
+#include "net_uring.h"
+#include <errno.h>
+#include <sys/syscall.h>
+
+struct io_uring_sqe *net_uring_get_sqe(net_uring_t *ring)
+{
+    unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+    unsigned index;
+    struct io_uring_sqe *sqe;
+
+    if (ring->sq_local_tail - head >= ring->sq_entries) {
+        net_uring_enter(ring, 0, 0);
+        head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+        if (ring->sq_local_tail - head >= ring->sq_entries)
+            return NULL;
+    }
+    index = ring->sq_local_tail & ring->sq_mask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[index] = index;
+    ring->sq_local_tail++;
+    ring->to_submit++;
+    return sqe;
+}
+
+static int enter_and_wait(net_uring_t *ring, unsigned min_complete,
+    long timeout_us)
+{
+    struct __kernel_timespec ts = {timeout_us / 1000000,
+        (long long)(timeout_us % 1000000) * 1000};
+    struct io_uring_getevents_arg arg;
+
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+    return syscall(__NR_io_uring_enter, ring->ring_fd, ring->to_submit,
+        min_complete, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+        &arg, sizeof(arg));
+}
+
+int net_uring_enter(net_uring_t *ring, unsigned min_complete,
+    long timeout_us)
+{
+    int ret = 0;
+
+    __atomic_store_n(ring->sq_tail, ring->sq_local_tail, __ATOMIC_RELEASE);
+    if (min_complete > 0)
+        ret = enter_and_wait(ring, min_complete, timeout_us);
+    else if (ring->to_submit > 0)
+        ret = syscall(__NR_io_uring_enter, ring->ring_fd, ring->to_submit,
+            0, 0, NULL, 0);
+    if (ret > 0)
+        ring->to_submit -= ((unsigned)ret > ring->to_submit) ?
+            ring->to_submit : (unsigned)ret;
+    if (ret < 0 && (errno == ETIME || errno == EINTR))
+        return 0;
+    return ret;
+}
+
+void net_uring_reap(net_uring_t *ring)
+{
+    unsigned head = *ring->cq_head;
+    unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        net_uring_handle_cqe(ring, &ring->cqes[head & ring->cq_mask]);
+        head++;
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+        tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    }
+}
+
+void net_uring_recycle(net_uring_t *ring, unsigned short bid)
+{
+    unsigned short tail = ring->buf_ring->tail;
+    struct io_uring_buf *buf;
+
+    buf = &ring->buf_ring->bufs[tail & (NET_NB_BUFS - 1)];
+    buf->addr = (uint64_t)(uintptr_t)(ring->buf_pool +
+        (size_t)bid * NET_BUF_SIZE);
+    buf->len = NET_BUF_SIZE;
+    buf->bid = bid;
+    __atomic_store_n(&ring->buf_ring->tail, (unsigned short)(tail + 1),
+        __ATOMIC_RELEASE);
+}
+
+uint64_t net_uring_data(net_uring_t *ring, net_op_t op, int fd)
+{
+    return ((uint64_t)op << NET_OP_SHIFT) |
+        ((uint64_t)(ring->gen[fd] & 0xffffff) << NET_GEN_SHIFT) |
+        (uint32_t)fd;
+}
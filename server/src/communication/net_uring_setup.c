@@ -0,0 +1,116 @@
+/*
+** EPITECH PROJECT, 2025
+** net_uring_setup.c
+** File description:
+** creation of the io_uring rings and of the provided buffer ring
+*/
+
+#include "net_uring.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+static void *map_ring_area(net_uring_t *ring, size_t size, off_t offset)
+{
+    return mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring->ring_fd, offset);
+}
+
+static int map_rings(net_uring_t *ring, struct io_uring_params *p)
+{
+    ring->sq_map_size = p->sq_off.array + p->sq_entries * sizeof(unsigned);
+    ring->cq_map_size = p->cq_off.cqes +
+        p->cq_entries * sizeof(struct io_uring_cqe);
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_map_size > ring->sq_map_size)
+            ring->sq_map_size = ring->cq_map_size;
+        ring->cq_map_size = 0;
+    }
+    ring->sq_map = map_ring_area(ring, ring->sq_map_size, IORING_OFF_SQ_RING);
+    ring->cq_map = ring->sq_map;
+    if (ring->cq_map_size > 0)
+        ring->cq_map = map_ring_area(ring, ring->cq_map_size,
+            IORING_OFF_CQ_RING);
+    ring->sqes_size = p->sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = map_ring_area(ring, ring->sqes_size, IORING_OFF_SQES);
+    if (ring->sq_map == MAP_FAILED || ring->cq_map == MAP_FAILED ||
+        ring->sqes == MAP_FAILED)
+        return -1;
+    return 0;
+}
+
+static void bind_ring_offsets(net_uring_t *ring, struct io_uring_params *p)
+{
+    char *sq = ring->sq_map;
+    char *cq = ring->cq_map;
+
+    ring->sq_head = (unsigned *)(sq + p->sq_off.head);
+    ring->sq_tail = (unsigned *)(sq + p->sq_off.tail);
+    ring->sq_array = (unsigned *)(sq + p->sq_off.array);
+    ring->sq_mask = *(unsigned *)(sq + p->sq_off.ring_mask);
+    ring->sq_entries = p->sq_entries;
+    ring->sq_local_tail = *ring->sq_tail;
+    ring->cq_head = (unsigned *)(cq + p->cq_off.head);
+    ring->cq_tail = (unsigned *)(cq + p->cq_off.tail);
+    ring->cq_mask = *(unsigned *)(cq + p->cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + p->cq_off.cqes);
+}
+
+static int register_buf_ring(net_uring_t *ring)
+{
+    struct io_uring_buf_reg reg;
+    size_t size = NET_NB_BUFS * sizeof(struct io_uring_buf);
+
+    ring->buf_ring = mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ring->buf_pool = malloc((size_t)NET_NB_BUFS * NET_BUF_SIZE);
+    if (ring->buf_ring == MAP_FAILED || !ring->buf_pool)
+        return -1;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)ring->buf_ring;
+    reg.ring_entries = NET_NB_BUFS;
+    reg.bgid = NET_BGID;
+    if (syscall(__NR_io_uring_register, ring->ring_fd,
+        IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+        return -1;
+    ring->buf_ring->tail = 0;
+    for (unsigned short bid = 0; bid < NET_NB_BUFS; bid++)
+        net_uring_recycle(ring, bid);
+    return 0;
+}
+
+int net_uring_setup(net_uring_t *ring)
+{
+    struct io_uring_params p;
+
+    memset(&p, 0, sizeof(p));
+    p.flags = IORING_SETUP_CQSIZE;
+    p.cq_entries = NET_CQ_ENTRIES;
+    ring->ring_fd = syscall(__NR_io_uring_setup, NET_SQ_ENTRIES, &p);
+    if (ring->ring_fd < 0 || map_rings(ring, &p) != 0) {
+        perror("io_uring_setup");
+        return -1;
+    }
+    bind_ring_offsets(ring, &p);
+    if (!(p.features & IORING_FEAT_EXT_ARG) || register_buf_ring(ring)) {
+        perror("io_uring_register");
+        return -1;
+    }
+    pthread_mutex_init(&ring->send_lock, NULL);
+    return 0;
+}
+
+void net_uring_teardown(net_uring_t *ring)
+{
+    if (ring->sqes && ring->sqes != MAP_FAILED)
+        munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_map_size > 0 && ring->cq_map != MAP_FAILED)
+        munmap(ring->cq_map, ring->cq_map_size);
+    if (ring->sq_map && ring->sq_map != MAP_FAILED)
+        munmap(ring->sq_map, ring->sq_map_size);
+    if (ring->buf_ring && ring->buf_ring != MAP_FAILED)
+        munmap(ring->buf_ring, NET_NB_BUFS * sizeof(struct io_uring_buf));
+    free(ring->buf_pool);
+    if (ring->ring_fd > 0)
+        close(ring->ring_fd);
+    pthread_mutex_destroy(&ring->send_lock);
+}
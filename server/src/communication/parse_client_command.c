@@ -35,18 +35,18 @@ static void discard_long_command(circbuf_t *cb, size_t newline_pos)
     }
 }
 
-static size_t get_command_len(circbuf_t *cb, size_t *newline_pos)
+static bool find_newline(circbuf_t *cb, size_t *newline_pos)
 {
     size_t i = 0;
 
     while (i < cb->len) {
         if (cb->data[(cb->tail + i) % CIRCBUF_SIZE] == '\n') {
             *newline_pos = i;
-            return i;
+            return true;
         }
         i++;
     }
-    return 0;
+    return false;
 }
 
 static void consume_crlf(circbuf_t *cb)
@@ -82,11 +82,9 @@ int read_command_from_buffer(circbuf_t *cb, char *dest, size_t max_len)
     size_t newline_pos = 0;
     size_t cmd_len = 0;
 
-    if (cb->len == 0)
-        return -1;
-    cmd_len = get_command_len(cb, &newline_pos);
-    if (cmd_len == 0)
+    if (cb->len == 0 || !find_newline(cb, &newline_pos))
         return -1;
+    cmd_len = newline_pos;
     if (cmd_len > 0 &&
         cb->data[(cb->tail + cmd_len - 1) % CIRCBUF_SIZE] == '\r')
         cmd_len--;
@@ -106,7 +104,7 @@ void handle_parse_result(int result,
     } else if (result == -2) {
         printf("[WARNING] Command too long from fd=%d, discarded\n",
             client->client->client_fd);
-    } else {
+    } else if (result == -1) {
         printf("[ERROR] Inconsistent state: "
             "has_complete_command true but read failed\n");
     }
@@ -122,8 +120,9 @@ void parse_client_command(server_t *serv, linked_client_t *client)
     while (has_complete_command(cb)) {
         result = read_command_from_buffer(cb, command, sizeof(command));
         handle_parse_result(result, client, command);
-        if (result <= 0)
+        if (result == -1)
             break;
-        parse_line_command(client, command);
+        if (result > 0)
+            parse_line_command(client, command);
     }
 }
@@ -24,26 +24,6 @@ static int find_command_in_table(char *command_name)
     return -1;
 }
 
-static char *duplicate_string(char *src)
-{
-    char *dest = NULL;
-    int len = 0;
-    int i = 0;
-
-    if (src == NULL)
-        return NULL;
-    len = strlen(src);
-    dest = malloc((len + 1) * sizeof(char));
-    if (dest == NULL)
-        return NULL;
-    while (i < len) {
-        dest[i] = src[i];
-        i++;
-    }
-    dest[i] = '\0';
-    return dest;
-}
-
 static void free_word_array(char **array)
 {
     int i = 0;
@@ -57,18 +37,16 @@ static void free_word_array(char **array)
     free(array);
 }
 
-static command_ai_t create_command(int cmd_index, char **parsed_command)
+static void fill_command(command_ai_t *cmd, int cmd_index,
+    char **parsed_command, char *long_args)
 {
-    command_ai_t new_command;
-
-    new_command.name = duplicate_string(tab_command_ai[cmd_index].name);
-    new_command.time = tab_command_ai[cmd_index].time;
-    if (parsed_command[1] != NULL) {
-        new_command.args = duplicate_string(parsed_command[1]);
-    } else {
-        new_command.args = NULL;
-    }
-    return new_command;
+    cmd->name = tab_command_ai[cmd_index].name;
+    cmd->index = cmd_index;
+    cmd->time = tab_command_ai[cmd_index].time;
+    cmd->args[0] = '\0';
+    cmd->long_args = long_args;
+    if (parsed_command[1] != NULL && long_args == NULL)
+        strcpy(cmd->args, parsed_command[1]);
 }
 
 static int validate_parse_parameters(linked_client_t *client,
@@ -115,17 +93,29 @@ static int check_command_exists(char **parsed_command, int client_fd)
 static int add_command_to_queue(linked_client_t *client, int cmd_index,
     char **parsed_command)
 {
-    command_ai_t new_command;
-
-    if (is_full_ai(client->player->command)) {
+    command_ai_t *new_command;
+    char *long_args = NULL;
+
+    // Arguments longer than a record, like a long Broadcast, go on the heap
+    if (parsed_command[1] != NULL &&
+        strlen(parsed_command[1]) >= CMD_ARGS_SIZE) {
+        long_args = strdup(parsed_command[1]);
+        if (long_args == NULL) {
+            perror("strdup");
+            send_responce(client->client->client_fd, "ko\n");
+            return -1;
+        }
+    }
+    new_command = enqueue(client->player->command);
+    if (new_command == NULL) {
         printf("[WARNING] Command queue full for player %d\n",
             client->player->id);
+        free(long_args);
         return -1;
     }
-    new_command = create_command(cmd_index, parsed_command);
-    enqueue(client->player->command, new_command);
+    fill_command(new_command, cmd_index, parsed_command, long_args);
     printf("[DEBUG] Command '%s' added to queue for player %d\n",
-        new_command.name, client->player->id);
+        new_command->name, client->player->id);
     return 0;
 }
 
@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** pollfd_slots.c
+** File description:
+** stack of the free pollfds slots, taken and given back in O(1)
+*/
+
+#include "socket.h"
+
+static server_t **get_instance_ptr(void)
+{
+    static __thread server_t *instance = NULL;
+
+    return &instance;
+}
+
+void init_pollfd_slots(server_t *serv)
+{
+    for (int i = 1; i <= MAX_CLIENTS; i++) {
+        serv->pollfds[i].fd = -1;
+        serv->pollfds[i].events = 0;
+        serv->pollfds[i].revents = 0;
+        serv->free_slots[MAX_CLIENTS - i] = i;
+    }
+    serv->nb_free_slots = MAX_CLIENTS;
+    serv->nb_clients = 0;
+    *get_instance_ptr() = serv;
+}
+
+int acquire_pollfd_slot(server_t *serv)
+{
+    if (serv->nb_free_slots == 0)
+        return -1;
+    serv->nb_free_slots--;
+    return serv->free_slots[serv->nb_free_slots];
+}
+
+void release_pollfd(struct pollfd *pollfd)
+{
+    server_t *serv = *get_instance_ptr();
+    long slot;
+
+    if (!pollfd)
+        return;
+    if (serv && pollfd->fd != -1) {
+        slot = pollfd - serv->pollfds;
+        if (slot > 0 && slot <= MAX_CLIENTS &&
+            serv->nb_free_slots < MAX_CLIENTS) {
+            serv->free_slots[serv->nb_free_slots] = (int)slot;
+            serv->nb_free_slots++;
+            serv->nb_clients--;
+        }
+    }
+    pollfd->fd = -1;
+    pollfd->events = 0;
+    pollfd->revents = 0;
+}
+
+// Called after the wait, stops once the ready entries are all found
+void collect_ready_slots(server_t *serv, int ready)
+{
+    serv->nb_ready = 0;
+    for (int i = 0; i < NB_POLLFDS && serv->nb_ready < ready; i++) {
+        if (serv->pollfds[i].fd != -1 && serv->pollfds[i].revents != 0)
+            add_ready_slot(serv, i);
+    }
+}
+
+void add_ready_slot(server_t *serv, int slot)
+{
+    if (slot >= 0 && slot < NB_POLLFDS && serv->nb_ready < NB_POLLFDS) {
+        serv->ready_slots[serv->nb_ready] = slot;
+        serv->nb_ready++;
+    }
+}
@@ -6,8 +6,9 @@
 */
 
 #include "socket.h"
+#include "net_backend.h"
 
 void send_responce(int fd, char *str)
 {
-    send(fd, str, strlen(str), 0);
+    net_send(fd, str, strlen(str));
 }
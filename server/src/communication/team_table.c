@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2025
+** team_table.c
+** File description:
+** open addressing table finding a team from its name
+*/
+
+#include "socket.h"
+
+static unsigned int hash_team_name(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*name) {
+        hash ^= (unsigned char)*name;
+        hash *= 16777619u;
+        name++;
+    }
+    return hash;
+}
+
+static void insert_team(server_t *serv, linked_teams_t *team)
+{
+    unsigned int i = hash_team_name(team->name_team) & serv->team_mask;
+
+    while (serv->team_table[i] != NULL)
+        i = (i + 1) & serv->team_mask;
+    serv->team_table[i] = team;
+}
+
+int build_team_table(server_t *serv)
+{
+    unsigned int size = 8;
+    int nb_teams = 0;
+
+    for (linked_teams_t *team = serv->head_team; team; team = team->next)
+        nb_teams++;
+    while (size < (unsigned int)nb_teams * 2)
+        size *= 2;
+    serv->team_table = calloc(size, sizeof(linked_teams_t *));
+    if (!serv->team_table) {
+        perror("calloc");
+        return 84;
+    }
+    serv->team_mask = size - 1;
+    for (linked_teams_t *team = serv->head_team; team; team = team->next)
+        insert_team(serv, team);
+    return 0;
+}
+
+linked_teams_t *get_team(server_t *serv, const char *team_name)
+{
+    unsigned int i;
+
+    if (!serv->team_table)
+        return NULL;
+    i = hash_team_name(team_name) & serv->team_mask;
+    while (serv->team_table[i] != NULL) {
+        if (strcmp(serv->team_table[i]->name_team, team_name) == 0)
+            return serv->team_table[i];
+        i = (i + 1) & serv->team_mask;
+    }
+    return NULL;
+}
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** destroy_server.c
+** File description:
+** release everything a hosted game owns, shared by main and the games
+*/
+
+#include "args.h"
+#include "game_info.h"
+#include "zappy.h"
+#include "tick_pool.h"
+#include "admin.h"
+#include "games.h"
+
+static void close_server_socket(server_t *server)
+{
+    if (server->inbox) {
+        destroy_game_inbox(server->inbox);
+        server->inbox = NULL;
+        server->sock.socket_fd = -1;
+    }
+    if (server->sock.socket_fd > 0) {
+        close(server->sock.socket_fd);
+        server->sock.socket_fd = -1;
+    }
+}
+
+void destroy_server(server_t *server)
+{
+    if (!server)
+        return;
+    destroy_teams(server->head_team);
+    server->head_team = NULL;
+    free(server->team_table);
+    server->team_table = NULL;
+    destroy_waiting_clients(server);
+    destroy_gui(server->gui_client);
+    server->gui_client = NULL;
+    destroy_tick_pool(server->pool);
+    server->pool = NULL;
+    admin_destroy(server->admin);
+    server->admin = NULL;
+    close_server_socket(server);
+}
+
+void destroy_all(args_t *args, game_info_t *game_info, server_t *server)
+{
+    if (server) {
+        destroy_server(server);
+        free(server);
+    }
+    if (game_info && args && game_info->teams == args->team_names) {
+        args->team_names = NULL;
+    }
+    if (game_info) {
+        destroy_game_info(game_info);
+    }
+    if (args) {
+        destroy_args(args);
+    }
+}
@@ -0,0 +1,19 @@
+/*
+** EPITECH PROJECT, 2025
+** admin_parser.c
+** File description:
+** parsing for the -a argument that is the path of the admin unix socket
+*/
+
+#include "args.h"
+#include <stddef.h>
+
+int admin_parser(args_t *args, size_t ac, char **av, size_t *i)
+{
+    if (*i + 1 >= ac || av[*i + 1][0] == '-' || args->admin_path != NULL) {
+        return -1;
+    }
+    args->admin_path = av[*i + 1];
+    *i += 1;
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** backlog_parser.c
+** File description:
+** parsing for the -b argument that is the listen backlog of the server
+*/
+
+#include "args.h"
+#include <stddef.h>
+
+int backlog_parser(args_t *args, size_t ac, char **av, size_t *i)
+{
+    if (*i + 1 >= ac || av[*i + 1][0] == '-') {
+        return -1;
+    }
+    args->backlog = atoi(av[*i + 1]);
+    if (args->backlog <= 0) {
+        return -1;
+    }
+    *i += 1;
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+** EPITECH PROJECT, 2025
+** games_parser.c
+** File description:
+** parsing for the -g argument that is the number of games hosted
+*/
+
+#include "args.h"
+#include <stddef.h>
+
+int games_parser(args_t *args, size_t ac, char **av, size_t *i)
+{
+    if (*i + 1 >= ac || av[*i + 1][0] == '-') {
+        return -1;
+    }
+    args->nb_games = atoi(av[*i + 1]);
+    if (args->nb_games <= 0 || args->nb_games > MAX_GAMES) {
+        return -1;
+    }
+    *i += 1;
+    return 0;
+}
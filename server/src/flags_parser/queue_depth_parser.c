@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** queue_depth_parser.c
+** File description:
+** parsing for the -q argument that is the command queue depth of a player
+*/
+
+#include "args.h"
+#include "player.h"
+#include <stddef.h>
+
+int queue_depth_parser(args_t *args, size_t ac, char **av, size_t *i)
+{
+    if (*i + 1 >= ac || av[*i + 1][0] == '-') {
+        return -1;
+    }
+    args->queue_depth = atoi(av[*i + 1]);
+    if (args->queue_depth <= 0 || args->queue_depth > MAX_QUEUE_DEPTH) {
+        return -1;
+    }
+    *i += 1;
+    return 0;
+}
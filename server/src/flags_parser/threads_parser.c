@@ -0,0 +1,23 @@
+/*
+** EPITECH PROJECT, 2025
+** threads_parser.c
+** File description:
+** parsing for the -t argument that is the number of tick worker threads
+*/
+
+#include "args.h"
+#include "tick_pool.h"
+#include <stddef.h>
+
+int threads_parser(args_t *args, size_t ac, char **av, size_t *i)
+{
+    if (*i + 1 >= ac || av[*i + 1][0] == '-') {
+        return -1;
+    }
+    args->nb_threads = atoi(av[*i + 1]);
+    if (args->nb_threads <= 0 || args->nb_threads > MAX_TICK_THREADS) {
+        return -1;
+    }
+    *i += 1;
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include "game_info.h"
 #include "player.h"
 #include "socket.h"
+#include "incantation.h"
 
 static void free_team_elements(char **team_names)
 {
@@ -34,10 +35,10 @@ static void destroy_player(player_t *player)
             free(player->team_name);
             player->team_name = NULL;
         }
-        if (player->command) {
-            free(player->command);
-            player->command = NULL;
-        }
+        destroy_queue_ai(player->command);
+        player->command = NULL;
+        free(player->look.response);
+        player->look.response = NULL;
     }
 }
 
@@ -64,6 +65,14 @@ void destroy_map(map_t *map)
     }
     free(map->block);
     map->block = NULL;
+    free(map->nb_players);
+    map->nb_players = NULL;
+    free(map->version);
+    map->version = NULL;
+    free(map->eggs);
+    map->eggs = NULL;
+    free(map->players);
+    map->players = NULL;
 }
 
 void destroy_game_info(game_info_t *game_info)
@@ -75,6 +84,8 @@ void destroy_game_info(game_info_t *game_info)
         game_info->teams = NULL;
     }
     destroy_map(&game_info->map);
+    free(game_info->dead);
+    destroy_incantations(game_info);
     free(game_info);
 }
 
@@ -112,6 +123,8 @@ void destroy_teams(linked_teams_t *head_team)
         }
         destroy_clients(current->head_client);
         current->head_client = NULL;
+        free(current->eggs.items);
+        free(current->unused.items);
         free(current);
         current = next;
     }
@@ -122,6 +135,8 @@ void destroy_gui(gui_t *gui)
     if (!gui)
         return;
     if (gui->queue_gui) {
+        while (!is_empty_gui(gui->queue_gui))
+            dequeue_gui(gui->queue_gui);
         free(gui->queue_gui);
         gui->queue_gui = NULL;
     }
@@ -131,3 +146,15 @@ void destroy_gui(gui_t *gui)
     }
     free(gui);
 }
+
+void destroy_waiting_clients(server_t *serv)
+{
+    for (int slot = 1; slot <= MAX_CLIENTS && serv->nb_waiting > 0; slot++) {
+        if (!serv->waiting[slot])
+            continue;
+        handle_disconnected_client(serv->waiting[slot]);
+        serv->waiting[slot] = NULL;
+        serv->nb_waiting--;
+    }
+    serv->nb_waiting = 0;
+}
@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2025
+** game_inbox.c
+** File description:
+** sockets handed by the router to a game thread, woken by an eventfd
+*/
+
+#include "games.h"
+#include <sys/eventfd.h>
+
+game_inbox_t *create_game_inbox(void)
+{
+    game_inbox_t *inbox = calloc(1, sizeof(game_inbox_t));
+
+    if (!inbox) {
+        perror("calloc");
+        return NULL;
+    }
+    inbox->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (inbox->event_fd < 0) {
+        perror("eventfd");
+        free(inbox);
+        return NULL;
+    }
+    pthread_mutex_init(&inbox->lock, NULL);
+    return inbox;
+}
+
+void destroy_game_inbox(game_inbox_t *inbox)
+{
+    if (!inbox)
+        return;
+    for (size_t i = 0; i < inbox->nb_items; i++)
+        close(inbox->items[i].fd);
+    free(inbox->items);
+    close(inbox->event_fd);
+    pthread_mutex_destroy(&inbox->lock);
+    free(inbox);
+}
+
+static bool grow_inbox(game_inbox_t *inbox)
+{
+    size_t new_cap = (inbox->cap_items == 0) ? 16 : inbox->cap_items * 2;
+    game_handoff_t *items;
+
+    items = realloc(inbox->items, new_cap * sizeof(game_handoff_t));
+    if (!items) {
+        perror("realloc");
+        return false;
+    }
+    inbox->items = items;
+    inbox->cap_items = new_cap;
+    return true;
+}
+
+bool push_game_inbox(game_inbox_t *inbox, const game_handoff_t *handoff)
+{
+    uint64_t one = 1;
+    bool pushed = true;
+
+    pthread_mutex_lock(&inbox->lock);
+    if (inbox->nb_items == inbox->cap_items && !grow_inbox(inbox))
+        pushed = false;
+    if (pushed) {
+        inbox->items[inbox->nb_items] = *handoff;
+        inbox->nb_items++;
+    }
+    pthread_mutex_unlock(&inbox->lock);
+    if (pushed && write(inbox->event_fd, &one, sizeof(one)) < 0)
+        perror("write");
+    return pushed;
+}
+
+bool pop_game_inbox(game_inbox_t *inbox, game_handoff_t *handoff)
+{
+    uint64_t count;
+    bool popped = false;
+
+    if (read(inbox->event_fd, &count, sizeof(count)) < 0)
+        count = 0;
+    pthread_mutex_lock(&inbox->lock);
+    if (inbox->nb_items > 0) {
+        inbox->nb_items--;
+        *handoff = inbox->items[inbox->nb_items];
+        popped = true;
+    }
+    pthread_mutex_unlock(&inbox->lock);
+    return popped;
+}
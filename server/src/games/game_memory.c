@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** game_memory.c
+** File description:
+** estimate of the heap memory owned by one game
+*/
+
+#include "games.h"
+#include "tick_pool.h"
+#include "incantation.h"
+#include "admin.h"
+
+static size_t player_footprint(linked_client_t *client)
+{
+    size_t size = sizeof(linked_client_t);
+    player_t *player = client->player;
+
+    if (client->client)
+        size += sizeof(client_t);
+    if (!player)
+        return size;
+    size += sizeof(player_t) + player->look.cap;
+    if (player->team_name)
+        size += strlen(player->team_name) + 1;
+    if (player->command)
+        size += sizeof(queue_command_ai_t) +
+            (player->command->mask + 1) * sizeof(command_ai_t);
+    return size;
+}
+
+static size_t map_footprint(map_t *map)
+{
+    size_t nb_tiles = (size_t)map->width * map->height;
+
+    return map->height * (sizeof(inventory_t *) + map->width *
+        sizeof(inventory_t)) + nb_tiles * (sizeof(int) +
+        sizeof(unsigned long) + sizeof(linked_client_t *));
+}
+
+static size_t teams_footprint(server_t *serv)
+{
+    size_t size = (serv->team_mask + 1) * sizeof(linked_teams_t *) +
+        serv->nb_waiting * sizeof(client_t);
+
+    for (linked_teams_t *team = serv->head_team; team; team = team->next) {
+        size += sizeof(linked_teams_t) + strlen(team->name_team) + 1 +
+            (team->eggs.cap + team->unused.cap) * sizeof(linked_client_t *);
+        for (linked_client_t *c = team->head_client; c; c = c->next)
+            size += player_footprint(c);
+    }
+    return size;
+}
+
+size_t game_memory_footprint(server_t *serv, game_info_t *game_info)
+{
+    size_t size = sizeof(server_t) + sizeof(game_info_t);
+
+    size += map_footprint(&game_info->map);
+    size += game_info->cap_dead * sizeof(linked_client_t *);
+    size += game_info->cap_rituals * sizeof(incantation_t *) +
+        game_info->nb_rituals * sizeof(incantation_t);
+    if (serv->pool)
+        size += sizeof(tick_pool_t) + serv->pool->cap_ready *
+            sizeof(ready_cmd_t);
+    if (serv->gui_client)
+        size += sizeof(gui_t) + sizeof(queue_command_gui_t);
+    return size + teams_footprint(serv);
+}
+
+void admin_memory(admin_conn_t *conn, server_t *serv,
+    game_info_t *game_info, char *args)
+{
+    (void)args;
+    admin_write(conn, "memory bytes=%zu map=%dx%d clients=%d\n",
+        game_memory_footprint(serv, game_info), game_info->map.width,
+        game_info->map.height, serv->nb_clients);
+}
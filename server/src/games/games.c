@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2025
+** games.c
+** File description:
+** one thread per hosted game, the main thread routes the connections
+*/
+
+#include "games.h"
+#include "zappy.h"
+#include "admin.h"
+#include "server_state.h"
+#include <signal.h>
+
+static void *run_game(void *arg)
+{
+    game_t *game = arg;
+
+    set_server_metrics(&game->metrics);
+    server_event_loop(game->serv, game->game_info);
+    __atomic_store_n(&game->finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static int create_game(game_t *game, args_t *args, int id)
+{
+    char path[108];
+
+    game->id = id;
+    set_server_metrics(&game->metrics);
+    game->game_info = initialize_game_info(args);
+    if (!game->game_info)
+        return 84;
+    game->serv = init_server(args, &game->game_info->next_id);
+    if (!game->serv)
+        return 84;
+    if (args->admin_path) {
+        snprintf(path, sizeof(path), "%s.%d", args->admin_path, id);
+        if (admin_init(game->serv, path) != 0)
+            return 84;
+    }
+    printf("Game %d ready, %zu bytes\n", id,
+        game_memory_footprint(game->serv, game->game_info));
+    return 0;
+}
+
+static int start_games(router_t *router, args_t *args)
+{
+    sigset_t mask;
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+    for (int i = 0; i < router->nb_games; i++) {
+        if (create_game(&router->games[i], args, i) != 0)
+            return 84;
+    }
+    for (int i = 0; i < router->nb_games; i++) {
+        if (pthread_create(&router->games[i].thread, NULL, run_game,
+            &router->games[i]) != 0) {
+            perror("pthread_create");
+            return 84;
+        }
+        router->games[i].started = true;
+    }
+    pthread_sigmask(SIG_UNBLOCK, &mask, NULL);
+    return 0;
+}
+
+static void stop_games(router_t *router, args_t *args)
+{
+    game_t *game;
+    uint64_t one = 1;
+
+    set_exit_server(true);
+    for (int i = 0; router->games && i < router->nb_games; i++) {
+        game = &router->games[i];
+        if (game->serv && write(game->serv->inbox->event_fd, &one,
+            sizeof(one)) < 0)
+            perror("write");
+        if (game->started)
+            pthread_join(game->thread, NULL);
+        if (game->game_info)
+            game->game_info->teams = NULL;
+        destroy_all(NULL, game->game_info, game->serv);
+    }
+    free(router->games);
+    if (router->listen_fd > 0)
+        close(router->listen_fd);
+    free(router);
+    destroy_args(args);
+}
+
+static int open_router(router_t *router, args_t *args)
+{
+    socket_t sock = {0};
+
+    sock.port = args->port;
+    sock.backlog = args->backlog;
+    if (init_socket(&sock) == 84)
+        return 84;
+    router->listen_fd = sock.socket_fd;
+    return 0;
+}
+
+int host_games(args_t *args)
+{
+    router_t *router = calloc(1, sizeof(router_t));
+    int status = 84;
+
+    if (!router) {
+        perror("calloc");
+        destroy_args(args);
+        return 84;
+    }
+    router->nb_games = args->nb_games;
+    router->games = calloc(args->nb_games, sizeof(game_t));
+    if (router->games && open_router(router, args) == 0 &&
+        start_games(router, args) == 0) {
+        printf("Hosting %d games on port %d\n", args->nb_games, args->port);
+        run_router(router);
+        status = 0;
+    }
+    stop_games(router, args);
+    return status;
+}
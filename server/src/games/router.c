@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** router.c
+** File description:
+** shared listener reading the handshake and handing sockets to the games
+*/
+
+#define _GNU_SOURCE
+#include "games.h"
+#include "server_state.h"
+#include <errno.h>
+
+static void remove_pending(router_t *router, int i, bool reject)
+{
+    int last = router->nb_pending;
+
+    if (reject) {
+        send(router->pfds[i].fd, "ko\n", 3, MSG_NOSIGNAL);
+        close(router->pfds[i].fd);
+    }
+    router->pfds[i] = router->pfds[last];
+    router->pending[i] = router->pending[last];
+    router->nb_pending--;
+}
+
+// Sockets that never finish their team line give their slot back
+static void expire_pending(router_t *router)
+{
+    for (int i = router->nb_pending; i > 0; i--) {
+        if (elapsed_us(&router->pending[i].accepted) >=
+            ROUTER_HANDSHAKE_MS * 1000UL)
+            remove_pending(router, i, true);
+    }
+}
+
+static void add_pending(router_t *router, int fd, struct sockaddr_in *addr)
+{
+    int i;
+
+    if (router->nb_pending == ROUTER_MAX_PENDING)
+        expire_pending(router);
+    i = router->nb_pending + 1;
+    if (router->nb_pending == ROUTER_MAX_PENDING) {
+        printf("Too many handshakes in progress, rejecting connection\n");
+        close(fd);
+        return;
+    }
+    router->pfds[i].fd = fd;
+    router->pfds[i].events = POLLIN;
+    router->pfds[i].revents = 0;
+    router->pending[i].fd = fd;
+    router->pending[i].addr = *addr;
+    router->pending[i].len = 0;
+    get_current_time(&router->pending[i].accepted);
+    router->nb_pending = i;
+    send(fd, "WELCOME\n", 8, MSG_NOSIGNAL);
+}
+
+static void accept_pending(router_t *router)
+{
+    struct sockaddr_in addr;
+    socklen_t addr_len;
+    int fd;
+
+    while (true) {
+        addr_len = sizeof(addr);
+        fd = accept4(router->listen_fd, (struct sockaddr *)&addr, &addr_len,
+            SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd >= 0) {
+            add_pending(router, fd, &addr);
+            continue;
+        }
+        if (errno != EINTR && errno != ECONNABORTED)
+            return;
+    }
+}
+
+static int find_game(router_t *router, game_handoff_t *handoff)
+{
+    char *newline = memchr(handoff->line, '\n', handoff->len);
+    char *at = memchr(handoff->line, '@', newline - handoff->line);
+    char *end = NULL;
+    long id = 0;
+
+    if (at) {
+        id = strtol(at + 1, &end, 10);
+        if (end == at + 1 || (*end != '\r' && *end != '\n'))
+            return -1;
+        // The game reads the team name alone, as when it owns the port
+        memmove(at, end, handoff->len - (end - handoff->line));
+        handoff->len -= end - at;
+    }
+    if (id < 0 || id >= router->nb_games ||
+        __atomic_load_n(&router->games[id].finished, __ATOMIC_ACQUIRE))
+        return -1;
+    return (int)id;
+}
+
+static void route_pending(router_t *router, int i)
+{
+    game_handoff_t *handoff = &router->pending[i];
+    ssize_t ret = recv(handoff->fd, handoff->line + handoff->len,
+        ROUTER_LINE_SIZE - handoff->len, 0);
+    int id;
+
+    if (ret < 0 && (errno == EAGAIN || errno == EINTR))
+        return;
+    if (ret <= 0) {
+        remove_pending(router, i, true);
+        return;
+    }
+    handoff->len += ret;
+    if (!memchr(handoff->line, '\n', handoff->len)) {
+        if (handoff->len == ROUTER_LINE_SIZE)
+            remove_pending(router, i, true);
+        return;
+    }
+    id = find_game(router, handoff);
+    remove_pending(router, i, id < 0 ||
+        !push_game_inbox(router->games[id].serv->inbox, handoff));
+}
+
+static bool all_games_finished(router_t *router)
+{
+    for (int i = 0; i < router->nb_games; i++) {
+        if (!__atomic_load_n(&router->games[i].finished, __ATOMIC_ACQUIRE))
+            return false;
+    }
+    return true;
+}
+
+void run_router(router_t *router)
+{
+    int ready;
+
+    router->pfds[0].fd = router->listen_fd;
+    router->pfds[0].events = POLLIN;
+    while (!should_exit_server() && !all_games_finished(router)) {
+        ready = poll(router->pfds, router->nb_pending + 1, ROUTER_WAIT_MS);
+        if (ready < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+        for (int i = router->nb_pending; ready > 0 && i > 0; i--) {
+            if (router->pfds[i].revents != 0)
+                route_pending(router, i);
+        }
+        expire_pending(router);
+        if (ready > 0 && (router->pfds[0].revents & POLLIN))
+            accept_pending(router);
+    }
+    while (router->nb_pending > 0)
+        remove_pending(router, router->nb_pending, true);
+}
@@ -73,7 +73,8 @@ static void place_resource_randomly(map_t *map, ressource_t type)
     int x = rand() % map->width;
     int y = rand() % map->height;
 
-    add_resource_to_tile(&map->block[x][y], type);
+    add_resource_to_tile(&map->block[y][x], type);
+    touch_tile(map, (coords_t){x, y});
 }
 
 static void generate_resource_type_limited(map_t *map, ressource_t type,
@@ -7,11 +7,14 @@
 
 #include "args.h"
 #include "socket.h"
+#include "tick_pool.h"
+#include "admin.h"
+#include "games.h"
 #include <fcntl.h>
 
 static int create_socket_fd(socket_t *sock)
 {
-    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
 
     if (fd < 0) {
         perror("socket");
@@ -55,7 +58,7 @@ static int do_bind(socket_t *sock)
 
 static int do_listen(socket_t *sock)
 {
-    if (listen(sock->socket_fd, BACKLOG) < 0) {
+    if (listen(sock->socket_fd, sock->backlog) < 0) {
         perror("listen");
         close(sock->socket_fd);
         return 84;
@@ -98,25 +101,54 @@ static void init_gui(server_t *serv)
     initialize_queue_gui(serv->gui_client->queue_gui);
 }
 
+static int init_routed_socket(server_t *serv)
+{
+    serv->inbox = create_game_inbox();
+    if (!serv->inbox)
+        return 84;
+    serv->sock.socket_fd = serv->inbox->event_fd;
+    serv->pollfds[0].fd = serv->sock.socket_fd;
+    serv->pollfds[0].events = POLLIN;
+    return 0;
+}
+
+static int init_server_socket(server_t *serv, args_t *args)
+{
+    serv->sock.port = args->port;
+    serv->sock.backlog = args->backlog;
+    serv->sock.disconect = false;
+    if (args->nb_games > 1)
+        return init_routed_socket(serv);
+    if (init_socket(&serv->sock) == 84)
+        return 84;
+    serv->pollfds[0].fd = serv->sock.socket_fd;
+    serv->pollfds[0].events = POLLIN;
+    if (args->admin_path && admin_init(serv, args->admin_path) != 0) {
+        close(serv->sock.socket_fd);
+        return 84;
+    }
+    return 0;
+}
+
 server_t *init_server(args_t *args, int *id)
 {
-    server_t *serv = malloc(sizeof(server_t));
+    server_t *serv = calloc(1, sizeof(server_t));
 
     if (!serv) {
         perror("malloc");
         return NULL;
     }
-    serv->sock.port = args->port;
-    serv->sock.disconect = false;
-    if (init_socket(&serv->sock) == 84) {
+    if (init_server_socket(serv, args) == 84) {
         free(serv);
         return NULL;
     }
-    serv->pollfds[0].fd = serv->sock.socket_fd;
-    serv->pollfds[0].events = POLLIN;
-    serv->head_team = NULL;
-    serv->nb_clients = 0;
+    set_queue_ai_depth(args->queue_depth);
     init_linked_teams(args, &serv->head_team, id);
     init_gui(serv);
+    serv->pool = create_tick_pool(args->nb_threads);
+    if (!serv->pool)
+        perror("malloc");
+    if (!serv->pool || build_team_table(serv) == 84)
+        return NULL;
     return serv;
 }
@@ -7,6 +7,7 @@
 
 #include "game_info.h"
 #include "player.h"
+#include "commands.h"
 
 void init_inventory(inventory_t *inv)
 {
@@ -30,27 +31,39 @@ static void init_inventory_empty(inventory_t *inv)
     inv->thystame = 0;
 }
 
+static void init_map_tiles(map_t *map)
+{
+    size_t nb_tiles = (size_t)map->width * map->height;
+
+    map->nb_players = calloc(nb_tiles, sizeof(int));
+    map->version = calloc(nb_tiles, sizeof(unsigned long));
+    map->eggs = calloc(nb_tiles, sizeof(struct linked_client_s *));
+    map->players = calloc(nb_tiles, sizeof(struct linked_client_s *));
+    if (!map->nb_players || !map->version || !map->eggs || !map->players)
+        fprintf(stderr, "Error: Memory allocation failed for map tiles.\n");
+}
+
 static void init_map(map_t *map, int width, int height)
 {
     map->width = width;
     map->height = height;
-    map->block = NULL;
-    map->block = malloc(sizeof(inventory_t *) * width + 1);
+    map->block = malloc(sizeof(inventory_t *) * height);
     if (!map->block) {
         fprintf(stderr, "Error: Memory allocation failed for map blocks.\n");
         return;
     }
-    for (int i = 0; i != width; i++) {
-        map->block[i] = malloc(sizeof(inventory_t) * height);
+    for (int i = 0; i != height; i++) {
+        map->block[i] = malloc(sizeof(inventory_t) * width);
         if (!map->block[i]) {
             fprintf(stderr, "Error: Memory allocation for map row %d.\n", i);
             return;
         }
-        for (int j = 0; j != height; j++) {
+        for (int j = 0; j != width; j++) {
             init_inventory_empty(&map->block[i][j]);
             map->block[i][j].food = 0;
         }
     }
+    init_map_tiles(map);
 }
 
 game_info_t *initialize_game_info(args_t *args)
@@ -59,7 +72,7 @@ game_info_t *initialize_game_info(args_t *args)
 
     if (args == NULL)
         return NULL;
-    game_info = malloc(sizeof(game_info_t));
+    game_info = calloc(1, sizeof(game_info_t));
     if (!game_info) {
         fprintf(stderr, "Error: Memory allocation failed for game_info.\n");
         return NULL;
@@ -71,6 +84,7 @@ game_info_t *initialize_game_info(args_t *args)
     init_map(&game_info->map, args->width, args->height);
     init_inventory(&game_info->global_inv);
     generate_res_map(game_info);
+    init_look_offsets();
     get_current_time(&game_info->time_gen);
     return game_info;
 }
@@ -8,13 +8,15 @@
 #include "game_info.h"
 #include "ressources.h"
 #include "socket.h"
+#include "net_backend.h"
+#include "incantation.h"
 
 static void free_player(player_t *player)
 {
     if (!player)
         return;
-    if (player->command)
-        free(player->command);
+    destroy_queue_ai(player->command);
+    free(player->look.response);
     if (player->team_name)
         free(player->team_name);
     free(player);
@@ -24,6 +26,7 @@ static void free_client(linked_client_t *node)
 {
     if (!node)
         return;
+    detach_from_incantation(node);
     if (node->client) {
         close_client_connection(node->client);
         free(node->client);
@@ -32,30 +35,24 @@ static void free_client(linked_client_t *node)
     free(node);
 }
 
-static void unlink_client(linked_teams_t *team,
-    linked_client_t *prev, linked_client_t *target)
+void add_client_to_team(linked_teams_t *team, linked_client_t *node)
 {
-    if (prev)
-        prev->next = target->next;
-    else
-        team->head_client = target->next;
+    node->prev = NULL;
+    node->next = team->head_client;
+    if (team->head_client)
+        team->head_client->prev = node;
+    team->head_client = node;
 }
 
-static void remove_client_from_team(linked_teams_t *team,
-    linked_client_t *target)
+void remove_client_from_team(linked_teams_t *team, linked_client_t *target)
 {
-    linked_client_t *current = team->head_client;
-    linked_client_t *prev = NULL;
-
-    while (current) {
-        if (current == target) {
-            unlink_client(team, prev, current);
-            free_client(current);
-            return;
-        }
-        prev = current;
-        current = current->next;
-    }
+    if (target->prev)
+        target->prev->next = target->next;
+    else
+        team->head_client = target->next;
+    if (target->next)
+        target->next->prev = target->prev;
+    free_client(target);
 }
 
 static void kill_player_from_egg(linked_teams_t *team, linked_client_t *client)
@@ -87,39 +84,21 @@ static void send_death_to_gui(int id, server_t *serv)
         return;
     }
     snprintf(response, sizeof(response), "pdi #%d\n", id);
-    send(serv->gui_client->client->client_fd, response, strlen(response), 0);
+    net_send(serv->gui_client->client->client_fd, response, strlen(response));
 }
 
-static void verif_death_team(linked_teams_t *team, game_info_t *game_info,
-    server_t *serv)
+void manage_death(server_t *serv, game_info_t *game_info)
 {
-    linked_client_t *client = team->head_client;
-    linked_client_t *next = NULL;
+    linked_client_t *client;
 
-    (void)game_info;
-    while (client != NULL) {
-        next = client->next;
+    for (size_t i = 0; i < game_info->nb_dead; i++) {
+        client = game_info->dead[i];
         if (client->client != NULL && client->player != NULL &&
-            client->player->state == DEAD) {
+            client->player->state == DEAD && client->player->team != NULL) {
             send_death_to_gui(client->player->id, serv);
-            how_kill_player(team, client);
-            client = next;
-        } else {
-            client = client->next;
-        }
-    }
-}
-
-void manage_death(server_t *serv, game_info_t *game_info)
-{
-    linked_teams_t *team = serv->head_team;
-
-    while (team != NULL) {
-        if (strcmp(team->name_team, "waiting_clients") == 0) {
-            team = team->next;
-            continue;
+            remove_max_level_player(serv, client->player);
+            how_kill_player(client->player->team, client);
         }
-        verif_death_team(team, game_info, serv);
-        team = team->next;
     }
+    game_info->nb_dead = 0;
 }
@@ -6,6 +6,7 @@
 */
 
 #include "commands.h"
+#include "net_backend.h"
 
 void reset_player(player_t *player)
 {
@@ -27,12 +28,27 @@ void close_client_connection(client_t *client)
     if (!client)
         return;
     if (client->client_fd > 0) {
-        close(client->client_fd);
+        net_close(client->client_fd);
         client->client_fd = -1;
     }
-    if (client->pollfd) {
-        client->pollfd->fd = -1;
-        client->pollfd->events = 0;
-        client->pollfd->revents = 0;
+    release_pollfd(client->pollfd);
+}
+
+void push_dead_player(game_info_t *game_info, linked_client_t *player)
+{
+    linked_client_t **dead;
+    size_t new_cap;
+
+    if (game_info->nb_dead == game_info->cap_dead) {
+        new_cap = (game_info->cap_dead == 0) ? 16 : game_info->cap_dead * 2;
+        dead = realloc(game_info->dead, sizeof(linked_client_t *) * new_cap);
+        if (!dead) {
+            perror("realloc");
+            return;
+        }
+        game_info->dead = dead;
+        game_info->cap_dead = new_cap;
     }
+    game_info->dead[game_info->nb_dead] = player;
+    game_info->nb_dead++;
 }
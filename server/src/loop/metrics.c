@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** metrics.c
+** File description:
+** Counters of the game run by the calling thread
+*/
+
+#include "metrics.h"
+#include <stdio.h>
+
+static server_metrics_t **get_instance_ptr(void)
+{
+    static __thread server_metrics_t *instance = NULL;
+
+    return &instance;
+}
+
+server_metrics_t *get_server_metrics(void)
+{
+    static server_metrics_t metrics = {0};
+    server_metrics_t **instance_ptr = get_instance_ptr();
+
+    if (*instance_ptr == NULL)
+        *instance_ptr = &metrics;
+    return *instance_ptr;
+}
+
+void set_server_metrics(server_metrics_t *metrics)
+{
+    *get_instance_ptr() = metrics;
+}
+
+static unsigned long elapsed_ns(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long)((now.tv_sec - start->tv_sec) * 1000000000L +
+        (now.tv_nsec - start->tv_nsec));
+}
+
+unsigned long elapsed_us(const struct timespec *start)
+{
+    return elapsed_ns(start) / 1000;
+}
+
+static int get_bucket(unsigned long us)
+{
+    unsigned long bound = METRICS_FIRST_BUCKET_US;
+    int bucket = 0;
+
+    while (bucket < METRICS_NB_BUCKETS - 1 && us > bound) {
+        bound *= 2;
+        bucket++;
+    }
+    return bucket;
+}
+
+void record_loop_time(const struct timespec *start)
+{
+    server_metrics_t *metrics = get_server_metrics();
+    unsigned long us = elapsed_us(start);
+
+    metrics->loop_hist[get_bucket(us)]++;
+    metrics->loops++;
+    if (us > metrics->loop_max_us)
+        metrics->loop_max_us = us;
+}
+
+void record_command(int index, const struct timespec *start)
+{
+    server_metrics_t *metrics = get_server_metrics();
+
+    if (index < 0 || index >= METRICS_NB_CMDS)
+        return;
+    __atomic_fetch_add(&metrics->cmd_count[index], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&metrics->cmd_ns[index], elapsed_ns(start),
+        __ATOMIC_RELAXED);
+}
+
+void record_command_wait(int ticks, double seconds)
+{
+    server_metrics_t *metrics = get_server_metrics();
+
+    metrics->ticks_done += ticks;
+    metrics->ticks_time += seconds;
+}
+
+void record_lateness(double seconds)
+{
+    server_metrics_t *metrics = get_server_metrics();
+    unsigned long us = (seconds > 0) ? (unsigned long)(seconds * 1000000) : 0;
+
+    metrics->late_hist[get_bucket(us)]++;
+    metrics->late_count++;
+    metrics->late_total_us += us;
+    if (us > metrics->late_max_us)
+        metrics->late_max_us = us;
+}
+
+void print_server_metrics(void)
+{
+    server_metrics_t *metrics = get_server_metrics();
+
+    printf("AI commands queued: %lu, dropped (queue full): %lu\n",
+        metrics->cmd_enqueued, metrics->cmd_overflows);
+    if (metrics->late_count > 0)
+        printf("Deadlines met: %lu, late by %lu us on average, %lu us max\n",
+            metrics->late_count, metrics->late_total_us / metrics->late_count,
+            metrics->late_max_us);
+}
@@ -8,6 +8,9 @@
 #include "game_info.h"
 #include "socket.h"
 #include "server_state.h"
+#include "net_backend.h"
+#include "metrics.h"
+#include "admin.h"
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -36,10 +39,14 @@ static void verif_new_connection(server_t *serv, int ready)
 
 static void signal_handler(int sig)
 {
+    static const char msg[] = "\nServer is closing by signal...\n";
+    int saved_errno = errno;
+
     if (sig == SIGINT) {
-        printf("\nServer is closing by signal...\n");
+        write(STDOUT_FILENO, msg, sizeof(msg) - 1);
         set_exit_server(true);
     }
+    errno = saved_errno;
 }
 
 static void handle_client_messages(linked_client_t *client, server_t *serv)
@@ -74,13 +81,10 @@ static void verif_new_message_teams(server_t *serv, game_info_t *game_info)
     linked_teams_t *tmp = serv->head_team;
     gui_t *gui = serv->gui_client;
 
+    manage_player_connect(serv, game_info);
     while (tmp != NULL) {
-        if (strcmp(tmp->name_team, "waiting_clients") != 0) {
-            handle_client_messages(tmp->head_client, serv);
-            change_after_connection(tmp->head_client);
-        } else {
-            manage_player_connect(serv, game_info);
-        }
+        handle_client_messages(tmp->head_client, serv);
+        change_after_connection(tmp->head_client);
         tmp = tmp->next;
     }
     if (gui != NULL && gui->client != NULL && gui->after_connect == true) {
@@ -98,40 +102,64 @@ static void init_server_pollfds(server_t *serv)
     serv->pollfds[0].fd = serv->sock.socket_fd;
     serv->pollfds[0].events = POLLIN;
     serv->pollfds[0].revents = 0;
-    for (int i = 1; i <= MAX_CLIENTS; i++) {
-        serv->pollfds[i].fd = -1;
-        serv->pollfds[i].events = 0;
-        serv->pollfds[i].revents = 0;
-    }
+    init_pollfd_slots(serv);
+    admin_watch(serv);
 }
 
 static void reset_pollfds(server_t *serv)
 {
-    for (int i = 0; i <= MAX_CLIENTS; i++) {
+    for (int i = 0; i < NB_POLLFDS; i++) {
         if (serv->pollfds[i].fd != -1) {
             serv->pollfds[i].revents = 0;
         }
     }
 }
 
-void server_event_loop(server_t *serv, game_info_t *game_info)
+static bool setup_event_loop(server_t *serv)
 {
-    int ready;
-
     signal(SIGINT, signal_handler);
-    init_server_state();
     init_server_pollfds(serv);
-    while (should_exit_server() == false &&
-        win_condition(serv, game_info) == false) {
-        reset_pollfds(serv);
-        ready = poll(serv->pollfds, MAX_CLIENTS + 1, 10);
-        error_poll(ready);
-        if (ready > 0) {
-            verif_new_connection(serv, ready);
-            verif_new_message_teams(serv, game_info);
-        }
-        manage_command(serv, game_info);
-        manage_death(serv, game_info);
+    get_current_time(&get_server_metrics()->start);
+    return net_backend_init(serv) == 0;
+}
+
+static void teardown_event_loop(server_t *serv)
+{
+    announce_winners(serv);
+    net_flush();
+    net_backend_destroy();
+    print_server_metrics();
+}
+
+static void run_loop_iteration(server_t *serv, game_info_t *game_info)
+{
+    struct timespec start;
+    int ready;
+
+    reset_pollfds(serv);
+    ready = net_wait(serv, next_wait_timeout(game_info));
+    error_poll(ready);
+    get_current_time(&start);
+    collect_ready_slots(serv, ready);
+    if (ready > 0) {
+        verif_new_connection(serv, ready);
+        verif_new_message_teams(serv, game_info);
     }
-    cleanup_server_state();
+    manage_command(serv, game_info);
+    manage_death(serv, game_info);
+    if (ready > 0)
+        admin_dispatch(serv, game_info);
+    net_flush();
+    record_loop_time(&start);
+}
+
+void server_event_loop(server_t *serv, game_info_t *game_info)
+{
+    serv->map = &game_info->map;
+    if (!setup_event_loop(serv))
+        return;
+    while (should_exit_server() == false &&
+        win_condition(serv, game_info) == false)
+        run_loop_iteration(serv, game_info);
+    teardown_event_loop(serv);
 }
@@ -42,7 +42,7 @@ void set_exit_server(bool value)
     server_state_t *state = get_server_state();
 
     if (state != NULL) {
-        state->exit_server = value;
+        __atomic_store_n(&state->exit_server, value, __ATOMIC_RELEASE);
     }
 }
 
@@ -51,7 +51,7 @@ bool should_exit_server(void)
     server_state_t *state = get_server_state();
 
     if (state != NULL) {
-        return state->exit_server;
+        return __atomic_load_n(&state->exit_server, __ATOMIC_ACQUIRE);
     }
     return false;
 }
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** tick_gui_out.c
+** File description:
+** GUI lines of the parallel phases, sent back in the order of the list
+*/
+
+#include "tick_pool.h"
+#include "net_backend.h"
+
+static gui_out_t **get_instance_ptr(void)
+{
+    static __thread gui_out_t *instance = NULL;
+
+    return &instance;
+}
+
+void set_tick_gui_out(gui_out_t *out)
+{
+    *get_instance_ptr() = out;
+}
+
+static bool append_gui_out(gui_out_t *out, const char *msg, size_t len)
+{
+    char *data;
+    size_t new_cap;
+
+    if (out->len + len > out->cap) {
+        new_cap = (out->cap == 0) ? 4096 : out->cap * 2;
+        while (new_cap < out->len + len)
+            new_cap *= 2;
+        data = realloc(out->data, new_cap);
+        if (!data) {
+            perror("realloc");
+            return false;
+        }
+        out->data = data;
+        out->cap = new_cap;
+    }
+    memcpy(out->data + out->len, msg, len);
+    out->len += len;
+    return true;
+}
+
+// Worker threads never write on the GUI socket, their band buffers it
+void send_gui_message(server_t *serv, const char *msg, size_t len)
+{
+    gui_out_t *out = *get_instance_ptr();
+
+    if (!serv->gui_client || !serv->gui_client->client)
+        return;
+    if (out) {
+        append_gui_out(out, msg, len);
+        return;
+    }
+    net_send(serv->gui_client->client->client_fd, msg, len);
+}
+
+void flush_tick_gui_out(tick_pool_t *pool)
+{
+    gui_out_t *flush = &pool->gui_flush;
+    ready_cmd_t *entry;
+    gui_t *gui = pool->serv->gui_client;
+
+    flush->len = 0;
+    for (size_t i = 0; i < pool->nb_ready; i++) {
+        entry = &pool->ready[i];
+        if (entry->phase == pool->phase && entry->gui_len > 0)
+            append_gui_out(flush, pool->gui_out[entry->band].data +
+                entry->gui_start, entry->gui_len);
+    }
+    for (int band = 0; band <= pool->nb_bands; band++)
+        pool->gui_out[band].len = 0;
+    if (flush->len > 0 && gui && gui->client)
+        net_send(gui->client->client_fd, flush->data, flush->len);
+}
@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** tick_pool.c
+** File description:
+** worker threads that execute the completed commands of their map band
+*/
+
+#include "tick_pool.h"
+
+static bool wait_for_phase(tick_pool_t *pool, unsigned long *seen)
+{
+    bool keep_running;
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop && pool->generation == *seen)
+        pthread_cond_wait(&pool->start_cond, &pool->lock);
+    *seen = pool->generation;
+    keep_running = !pool->stop;
+    pthread_mutex_unlock(&pool->lock);
+    return keep_running;
+}
+
+static void *tick_worker(void *arg)
+{
+    tick_worker_t *worker = arg;
+    tick_pool_t *pool = worker->pool;
+    unsigned long seen = 0;
+
+    set_server_metrics(pool->metrics);
+    while (wait_for_phase(pool, &seen)) {
+        run_band_commands(pool, worker->band);
+        pthread_mutex_lock(&pool->lock);
+        pool->running--;
+        if (pool->running == 0)
+            pthread_cond_signal(&pool->done_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+tick_pool_t *create_tick_pool(int nb_bands)
+{
+    tick_pool_t *pool = calloc(1, sizeof(tick_pool_t));
+
+    if (!pool)
+        return NULL;
+    pool->nb_bands = (nb_bands < 1) ? 1 : nb_bands;
+    pool->metrics = get_server_metrics();
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+    for (int i = 1; i < pool->nb_bands; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].band = i;
+        if (pthread_create(&pool->threads[i], NULL, tick_worker,
+            &pool->workers[i]) != 0) {
+            perror("pthread_create");
+            pool->nb_bands = i;
+            break;
+        }
+    }
+    return pool;
+}
+
+void destroy_tick_pool(tick_pool_t *pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 1; i < pool->nb_bands; i++)
+        pthread_join(pool->threads[i], NULL);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_cond_destroy(&pool->done_cond);
+    for (int i = 0; i <= MAX_TICK_THREADS; i++)
+        free(pool->gui_out[i].data);
+    free(pool->gui_flush.data);
+    free(pool->ready);
+    free(pool);
+}
+
+void run_tick_phase(tick_pool_t *pool, exec_phase_t phase)
+{
+    pool->phase = phase;
+    if (pool->nb_phase[phase] == 0)
+        return;
+    if (pool->nb_bands == 1) {
+        run_band_commands(pool, 0);
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->running = pool->nb_bands - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+    run_band_commands(pool, 0);
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+    run_band_commands(pool, pool->nb_bands);
+}
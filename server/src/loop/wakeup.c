@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** wakeup.c
+** File description:
+** earliest deadline of the game, used as the timeout of the next wait
+*/
+
+#include "game_info.h"
+#include "incantation.h"
+
+void plan_wakeup_at(game_info_t *game_info, double when)
+{
+    if (when < game_info->wake_at)
+        game_info->wake_at = when;
+}
+
+void plan_wakeup(game_info_t *game_info, struct timespec *start,
+    double delay)
+{
+    plan_wakeup_at(game_info, start->tv_sec +
+        start->tv_nsec / 1000000000.0 + delay);
+}
+
+long next_wait_timeout(game_info_t *game_info)
+{
+    long max_us = MAX_WAIT_US;
+    double delay = game_info->wake_at - get_time_seconds();
+
+    game_info->wake_at = get_time_seconds() + max_us / 1000000.0;
+    if (delay <= 0)
+        return 0;
+    if (delay * 1000000.0 >= max_us)
+        return max_us;
+    return (long)(delay * 1000000.0) + 1;
+}
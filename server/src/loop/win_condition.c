@@ -9,33 +9,47 @@
 #include "game_info.h"
 #include "player.h"
 #include "socket.h"
+#include "net_backend.h"
 #include <string.h>
 
-static bool verif_win_team(linked_teams_t *teams, game_info_t *game_info)
+void add_max_level_player(server_t *serv, player_t *player)
 {
-    linked_client_t *client = teams->head_client;
+    if (player->level != 8 || player->team == NULL)
+        return;
+    player->team->nb_max_level++;
+    if (player->team->nb_max_level == 1)
+        serv->nb_winning_teams++;
+}
 
-    (void)game_info;
-    while (client) {
-        if (client->player != NULL && client->player->state != UNUSED &&
-            client->player->level == 8)
-            return true;
-        client = client->next;
-    }
-    return false;
+void remove_max_level_player(server_t *serv, player_t *player)
+{
+    if (player->level != 8 || player->team == NULL ||
+        player->team->nb_max_level == 0)
+        return;
+    player->team->nb_max_level--;
+    if (player->team->nb_max_level == 0)
+        serv->nb_winning_teams--;
 }
 
 bool win_condition(server_t *serv, game_info_t *game_info)
 {
-    linked_teams_t *teams = serv->head_team;
-    bool ret = false;
+    (void)game_info;
+    return serv->nb_winning_teams > 0;
+}
+
+void announce_winners(server_t *serv)
+{
+    linked_teams_t *team = serv->head_team;
+    char response[256];
 
-    while (teams) {
-        if (strcmp(teams->name_team, "waiting_clients") != 0 &&
-            teams->head_client != NULL) {
-            ret = verif_win_team(teams, game_info);
+    while (team != NULL) {
+        if (team->nb_max_level > 0) {
+            printf("Team %s wins the game\n", team->name_team);
+            snprintf(response, sizeof(response), "seg %s\n", team->name_team);
+            if (serv->gui_client && serv->gui_client->client)
+                net_send(serv->gui_client->client->client_fd, response,
+                    strlen(response));
         }
-        teams = teams->next;
+        team = team->next;
     }
-    return ret;
 }
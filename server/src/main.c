@@ -9,47 +9,16 @@
 #include "game_info.h"
 #include "zappy.h"
 #include "socket.h"
+#include "games.h"
+#include "server_state.h"
 
-void destroy_server(server_t *server)
+static int host_game(args_t *args)
 {
-    if (!server)
-        return;
-    destroy_teams(server->head_team);
-    server->head_team = NULL;
-    destroy_gui(server->gui_client);
-    server->gui_client = NULL;
-    if (server->sock.socket_fd > 0) {
-        close(server->sock.socket_fd);
-        server->sock.socket_fd = -1;
-    }
-}
-
-void destroy_all(args_t *args, game_info_t *game_info, server_t *server)
-{
-    if (server) {
-        destroy_server(server);
-        free(server);
-    }
-    if (game_info && args && game_info->teams == args->team_names) {
-        args->team_names = NULL;
-    }
-    if (game_info) {
-        destroy_game_info(game_info);
-    }
-    if (args) {
-        destroy_args(args);
-    }
-}
-
-int main(int argc, char **argv)
-{
-    args_t *args = parser_arguments(argc, argv);
     game_info_t *game_info = initialize_game_info(args);
     server_t *server;
 
-    if (args == NULL || game_info == NULL) {
-        fprintf(stderr,
-            "Error: Invalid arguments or game info initialization failed.\n");
+    if (game_info == NULL) {
+        fprintf(stderr, "Error: Game info initialization failed.\n");
         destroy_args(args);
         return 84;
     }
@@ -60,7 +29,27 @@ int main(int argc, char **argv)
         return 84;
     }
     printf("freq : %d\n", game_info->freq);
+    printf("Game ready, %zu bytes\n",
+        game_memory_footprint(server, game_info));
     server_event_loop(server, game_info);
     destroy_all(args, game_info, server);
     return 0;
 }
+
+int main(int argc, char **argv)
+{
+    args_t *args = parser_arguments(argc, argv);
+    int status;
+
+    if (args == NULL) {
+        fprintf(stderr, "Error: Invalid arguments.\n");
+        return 84;
+    }
+    init_server_state();
+    if (args->nb_games > 1)
+        status = host_games(args);
+    else
+        status = host_game(args);
+    cleanup_server_state();
+    return status;
+}
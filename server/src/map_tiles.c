@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** map_tiles.c
+** File description:
+** per tile occupancy, players and versions read by look and eject
+*/
+
+#include "map.h"
+#include "socket.h"
+
+int tile_index(map_t *map, coords_t coords)
+{
+    return coords.y * map->width + coords.x;
+}
+
+void touch_tile(map_t *map, coords_t coords)
+{
+    if (!map->version)
+        return;
+    map->version[tile_index(map, coords)]++;
+}
+
+// Ordered by id, so Eject answers alike whatever the bands of the tick
+static void link_tile_player(linked_client_t **head, linked_client_t *client)
+{
+    linked_client_t *prev = NULL;
+    linked_client_t *next = *head;
+
+    while (next && next->player->id < client->player->id) {
+        prev = next;
+        next = next->player->tile_next;
+    }
+    client->player->tile_prev = prev;
+    client->player->tile_next = next;
+    if (prev)
+        prev->player->tile_next = client;
+    else
+        *head = client;
+    if (next)
+        next->player->tile_prev = client;
+}
+
+void enter_tile(map_t *map, linked_client_t *client)
+{
+    player_t *player = client->player;
+    int tile;
+
+    if (!map->nb_players || !map->players || player->state != ALIVE)
+        return;
+    tile = tile_index(map, player->coords);
+    map->nb_players[tile]++;
+    link_tile_player(&map->players[tile], client);
+    touch_tile(map, player->coords);
+}
+
+void leave_tile(map_t *map, linked_client_t *client)
+{
+    player_t *player = client->player;
+    int tile;
+
+    if (!map->nb_players || !map->players || player->state != ALIVE)
+        return;
+    tile = tile_index(map, player->coords);
+    map->nb_players[tile]--;
+    if (player->tile_prev)
+        player->tile_prev->player->tile_next = player->tile_next;
+    else if (map->players[tile] == client)
+        map->players[tile] = player->tile_next;
+    if (player->tile_next)
+        player->tile_next->player->tile_prev = player->tile_prev;
+    player->tile_next = NULL;
+    player->tile_prev = NULL;
+    touch_tile(map, player->coords);
+}
+
+linked_client_t *get_tile_players(map_t *map, coords_t coords)
+{
+    return map->players[tile_index(map, coords)];
+}
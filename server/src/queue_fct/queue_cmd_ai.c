@@ -6,30 +6,44 @@
 */
 
 #include "commands.h"
+#include "metrics.h"
 
 void initialize_queue_ai(queue_command_ai_t *q)
 {
+    while (!is_empty_ai(q))
+        dequeue(q);
     q->front = 0;
     q->rear = 0;
 }
 
-void enqueue(queue_command_ai_t *q, command_ai_t value)
+command_ai_t *enqueue(queue_command_ai_t *q)
 {
+    command_ai_t *slot;
+
     if (is_full_ai(q)) {
-        printf("Queue is full\n");
-        return;
+        q->overflows++;
+        get_server_metrics()->cmd_overflows++;
+        return NULL;
     }
-    q->command[q->rear] = value;
-    q->rear = (q->rear + 1) % 10;
+    slot = &q->command[q->rear & q->mask];
+    slot->long_args = NULL;
+    q->rear++;
+    get_server_metrics()->cmd_enqueued++;
+    return slot;
 }
 
 void dequeue(queue_command_ai_t *q)
 {
+    command_ai_t *cmd;
+
     if (is_empty_ai(q)) {
         printf("Queue is empty\n");
         return;
     }
-    q->front = (q->front + 1) % 10;
+    cmd = &q->command[q->front & q->mask];
+    free(cmd->long_args);
+    cmd->long_args = NULL;
+    q->front++;
 }
 
 command_ai_t *peek(queue_command_ai_t *q)
@@ -38,5 +52,10 @@ command_ai_t *peek(queue_command_ai_t *q)
         printf("Queue is empty\n");
         return NULL;
     }
-    return &q->command[q->front];
+    return &q->command[q->front & q->mask];
+}
+
+char *get_command_args(command_ai_t *cmd)
+{
+    return cmd->long_args ? cmd->long_args : cmd->args;
 }
@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** queue_cmd_ai_alloc.c
+** File description:
+** allocation of the command ring of a player, sized by the -q argument
+*/
+
+#include "player.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static int *get_depth_ptr(void)
+{
+    static int depth = DEFAULT_QUEUE_DEPTH;
+
+    return &depth;
+}
+
+void set_queue_ai_depth(int depth)
+{
+    *get_depth_ptr() = depth;
+}
+
+static unsigned int round_up_pow2(unsigned int value)
+{
+    unsigned int size = 1;
+
+    while (size < value)
+        size <<= 1;
+    return size;
+}
+
+queue_command_ai_t *create_queue_ai(void)
+{
+    queue_command_ai_t *q = malloc(sizeof(queue_command_ai_t));
+    unsigned int size = round_up_pow2(*get_depth_ptr());
+
+    if (!q) {
+        perror("malloc");
+        return NULL;
+    }
+    q->command = malloc(sizeof(command_ai_t) * size);
+    if (!q->command) {
+        perror("malloc");
+        free(q);
+        return NULL;
+    }
+    q->mask = size - 1;
+    q->depth = *get_depth_ptr();
+    q->overflows = 0;
+    q->front = 0;
+    q->rear = 0;
+    return q;
+}
+
+void destroy_queue_ai(queue_command_ai_t *q)
+{
+    if (!q)
+        return;
+    initialize_queue_ai(q);
+    free(q->command);
+    free(q);
+}
@@ -14,5 +14,5 @@ bool is_empty_ai(queue_command_ai_t *q)
 
 bool is_full_ai(queue_command_ai_t *q)
 {
-    return ((q->rear + 1) % 10 == q->front);
+    return (q->rear - q->front >= q->depth);
 }
@@ -22,11 +22,22 @@ void enqueue_gui(queue_command_gui_t *q, command_gui_t value)
     q->rear = (q->rear + 1) % 10;
 }
 
+static void free_command_gui(command_gui_t *cmd)
+{
+    free(cmd->name);
+    cmd->name = NULL;
+    for (size_t i = 0; cmd->args && cmd->args[i]; i++)
+        free(cmd->args[i]);
+    free(cmd->args);
+    cmd->args = NULL;
+}
+
 void dequeue_gui(queue_command_gui_t *q)
 {
     if (is_empty_gui(q)) {
         return;
     }
+    free_command_gui(&q->command[q->front]);
     q->front = (q->front + 1) % 10;
 }
 
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** team_slots.c
+** File description:
+** eggs and unused slots of the teams, pushed and taken in O(1)
+*/
+
+#include "team_slots.h"
+
+static bool push_slot(slot_stack_t *stack, linked_client_t *slot)
+{
+    size_t new_cap = (stack->cap == 0) ? 16 : stack->cap * 2;
+    linked_client_t **items;
+
+    if (stack->nb == stack->cap) {
+        items = realloc(stack->items, sizeof(linked_client_t *) * new_cap);
+        if (!items) {
+            perror("realloc");
+            return false;
+        }
+        stack->items = items;
+        stack->cap = new_cap;
+    }
+    slot->player->slot_index = (int)stack->nb;
+    stack->items[stack->nb] = slot;
+    stack->nb++;
+    return true;
+}
+
+static void remove_slot(slot_stack_t *stack, linked_client_t *slot)
+{
+    int index = slot->player->slot_index;
+    linked_client_t *last;
+
+    if (index < 0 || (size_t)index >= stack->nb ||
+        stack->items[index] != slot)
+        return;
+    stack->nb--;
+    last = stack->items[stack->nb];
+    stack->items[index] = last;
+    last->player->slot_index = index;
+    slot->player->slot_index = -1;
+}
+
+void add_unused_slot(linked_teams_t *team, linked_client_t *slot)
+{
+    push_slot(&team->unused, slot);
+}
+
+void add_egg(linked_teams_t *team, linked_client_t *egg, map_t *map)
+{
+    linked_client_t **head = &map->eggs[tile_index(map, egg->player->coords)];
+
+    if (!push_slot(&team->eggs, egg))
+        return;
+    egg->player->egg_prev = NULL;
+    egg->player->egg_next = *head;
+    if (*head)
+        (*head)->player->egg_prev = egg;
+    *head = egg;
+}
+
+void remove_egg(linked_teams_t *team, linked_client_t *egg, map_t *map)
+{
+    player_t *player = egg->player;
+    int tile = tile_index(map, player->coords);
+
+    remove_slot(&team->eggs, egg);
+    if (player->egg_prev)
+        player->egg_prev->player->egg_next = player->egg_next;
+    else if (map->eggs[tile] == egg)
+        map->eggs[tile] = player->egg_next;
+    if (player->egg_next)
+        player->egg_next->player->egg_prev = player->egg_prev;
+    player->egg_next = NULL;
+    player->egg_prev = NULL;
+}
+
+linked_client_t *take_team_slot(linked_teams_t *team, map_t *map)
+{
+    linked_client_t *slot;
+
+    if (team->eggs.nb > 0) {
+        slot = team->eggs.items[rand() % team->eggs.nb];
+        remove_egg(team, slot, map);
+        return slot;
+    }
+    if (team->unused.nb == 0)
+        return NULL;
+    slot = team->unused.items[team->unused.nb - 1];
+    remove_slot(&team->unused, slot);
+    return slot;
+}
+
+int count_team_slots(linked_teams_t *team)
+{
+    return (int)(team->eggs.nb + team->unused.nb);
+}
+
+linked_client_t *get_tile_eggs(map_t *map, coords_t coords)
+{
+    return map->eggs[tile_index(map, coords)];
+}
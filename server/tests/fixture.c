@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** fixture.c
+** File description:
+** small game with two teams and no socket, shared by the tests
+*/
+
+#include "tests.h"
+#include "zappy.h"
+#include "team_slots.h"
+
+static void set_fixture_args(fixture_t *fx, int width, int height, int slots)
+{
+    fx->team_names[0] = "a";
+    fx->team_names[1] = "b";
+    fx->args.width = width;
+    fx->args.height = height;
+    fx->args.frequency = 100;
+    fx->args.team_names = fx->team_names;
+    fx->args.team_count = slots;
+    fx->args.nb_threads = 1;
+}
+
+fixture_t *create_fixture(int width, int height)
+{
+    return create_fixture_slots(width, height, FIXTURE_SLOTS);
+}
+
+fixture_t *create_fixture_slots(int width, int height, int slots)
+{
+    fixture_t *fx = calloc(1, sizeof(fixture_t));
+
+    if (!fx)
+        return NULL;
+    set_fixture_args(fx, width, height, slots);
+    fx->game_info = initialize_game_info(&fx->args);
+    fx->serv = calloc(1, sizeof(server_t));
+    fx->serv->sock.socket_fd = -1;
+    fx->serv->map = &fx->game_info->map;
+    init_linked_teams(&fx->args, &fx->serv->head_team,
+        &fx->game_info->next_id);
+    build_team_table(fx->serv);
+    clear_map(fx);
+    return fx;
+}
+
+void destroy_fixture(fixture_t *fx)
+{
+    fx->game_info->teams = NULL;
+    destroy_all(NULL, fx->game_info, fx->serv);
+    free(fx);
+}
+
+void clear_map(fixture_t *fx)
+{
+    map_t *map = &fx->game_info->map;
+
+    for (int y = 0; y < map->height; y++) {
+        for (int x = 0; x < map->width; x++) {
+            memset(&map->block[y][x], 0, sizeof(inventory_t));
+            touch_tile(map, (coords_t){x, y});
+        }
+    }
+}
+
+static linked_client_t *take_any_slot(fixture_t *fx)
+{
+    linked_teams_t *team = fx->serv->head_team;
+    linked_client_t *slot = NULL;
+
+    while (team && !slot) {
+        slot = take_team_slot(team, &fx->game_info->map);
+        team = team->next;
+    }
+    return slot;
+}
+
+linked_client_t *spawn_player(fixture_t *fx, coords_t coords,
+    direction_t direction, int fd)
+{
+    linked_client_t *slot = take_any_slot(fx);
+
+    if (!slot)
+        return NULL;
+    slot->client = calloc(1, sizeof(client_t));
+    slot->client->client_fd = fd;
+    slot->player->coords = coords;
+    slot->player->direction = direction;
+    slot->player->state = ALIVE;
+    enter_tile(&fx->game_info->map, slot);
+    get_current_time(&slot->player->time_eat);
+    return slot;
+}
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** fuzz_driver.c
+** File description:
+** random inputs for the fuzz entry when libFuzzer is not available
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+    #define DRIVER_MAX_LEN 12288
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static const char *fragments[] = {
+    "Forward", "Right", "Left", "Look", "Inventory", "Broadcast",
+    "Connect_nbr", "Fork", "Eject", "Take", "Set", "Incantation",
+    " food", " linemate", " ", "\t", "\n", "\r\n", "\r", "@1", "GRAPHIC",
+    NULL
+};
+
+static size_t add_token(uint8_t *buf, size_t len)
+{
+    static int nb = 0;
+    const char *token;
+    size_t token_len;
+
+    while (fragments[nb])
+        nb++;
+    token = fragments[rand() % nb];
+    token_len = strlen(token);
+    if (len + token_len > DRIVER_MAX_LEN)
+        return 0;
+    memcpy(buf + len, token, token_len);
+    return token_len;
+}
+
+static size_t add_fragment(uint8_t *buf, size_t len)
+{
+    int kind = rand() % 10;
+    size_t frag_len;
+
+    if (kind < 7)
+        return add_token(buf, len);
+    frag_len = (kind == 9) ? rand() % 5000 : rand() % 16;
+    if (len + frag_len > DRIVER_MAX_LEN)
+        frag_len = DRIVER_MAX_LEN - len;
+    for (size_t i = 0; i < frag_len; i++)
+        buf[len + i] = (kind == 8) ? 'x' : rand() % 256;
+    return frag_len;
+}
+
+int main(int ac, char **av)
+{
+    long runs = (ac > 1) ? atol(av[1]) : 100000;
+    unsigned int seed = (ac > 2) ? atoi(av[2]) : time(NULL);
+    static uint8_t buf[DRIVER_MAX_LEN];
+    size_t len;
+
+    freopen("/dev/null", "w", stdout);
+    srand(seed);
+    for (long run = 0; run < runs; run++) {
+        len = 0;
+        buf[len++] = rand() % 256;
+        for (int i = rand() % 40; i > 0 && len < DRIVER_MAX_LEN; i--)
+            len += add_fragment(buf, len);
+        LLVMFuzzerTestOneInput(buf, len);
+    }
+    fprintf(stderr, "Fuzzed %ld inputs, seed %u\n", runs, seed);
+    return 0;
+}
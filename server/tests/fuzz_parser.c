@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** fuzz_parser.c
+** File description:
+** libFuzzer entry feeding raw client bytes to the command parser
+*/
+
+#include "tests.h"
+#include <stdint.h>
+
+    #define FUZZ_FD 3
+
+static linked_client_t *get_fuzz_client(void)
+{
+    static fixture_t *fx = NULL;
+    static linked_client_t *client = NULL;
+
+    if (!fx) {
+        fx = create_fixture(5, 5);
+        client = spawn_player(fx, (coords_t){0, 0}, UP, FUZZ_FD);
+    }
+    return client;
+}
+
+static void check_circbuf(circbuf_t *cb)
+{
+    if (cb->len > CIRCBUF_SIZE || cb->head >= CIRCBUF_SIZE ||
+        cb->tail >= CIRCBUF_SIZE ||
+        cb->head != (cb->tail + cb->len) % CIRCBUF_SIZE)
+        abort();
+    if (has_complete_command(cb))
+        abort();
+}
+
+static void check_and_drain_queue(queue_command_ai_t *queue)
+{
+    command_ai_t *cmd;
+
+    if (queue->rear - queue->front > queue->depth)
+        abort();
+    while (!is_empty_ai(queue)) {
+        cmd = peek(queue);
+        if (strcmp(cmd->name, tab_command_ai[cmd->index].name) != 0 ||
+            strlen(cmd->args) >= CMD_ARGS_SIZE ||
+            (cmd->long_args && strlen(cmd->long_args) < CMD_ARGS_SIZE))
+            abort();
+        dequeue(queue);
+    }
+}
+
+static void feed_chunks(linked_client_t *client, const uint8_t *data,
+    size_t size)
+{
+    size_t chunk = 1 + data[0] % 64;
+
+    for (size_t pos = 1; pos < size; pos += chunk) {
+        if (chunk > size - pos)
+            chunk = size - pos;
+        stub_feed(FUZZ_FD, data + pos, chunk);
+        if (receive_into_circbuf(client->client) == 84) {
+            memset(&client->client->circbuf, 0, sizeof(circbuf_t));
+            continue;
+        }
+        parse_client_command(NULL, client);
+        check_circbuf(&client->client->circbuf);
+        if (data[pos] % 4 == 0)
+            check_and_drain_queue(client->player->command);
+    }
+}
+
+static void fuzz_line(linked_client_t *client, const uint8_t *data,
+    size_t size)
+{
+    char *line = malloc(size + 1);
+
+    if (!line)
+        return;
+    memcpy(line, data, size);
+    line[size] = '\0';
+    parse_line_command(client, line);
+    check_and_drain_queue(client->player->command);
+    free(line);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    linked_client_t *client = get_fuzz_client();
+
+    if (size == 0)
+        return 0;
+    memset(&client->client->circbuf, 0, sizeof(circbuf_t));
+    feed_chunks(client, data, size);
+    check_and_drain_queue(client->player->command);
+    fuzz_line(client, data, size);
+    stub_clear();
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2025
+** net_stub.c
+** File description:
+** network backend keeping the sent bytes in memory for the tests
+*/
+
+#include "net_backend.h"
+#include <errno.h>
+#include <string.h>
+
+    #define STUB_MAX_FD 64
+    #define STUB_BUF_SIZE 65536
+
+typedef struct stub_fd_s {
+    char out[STUB_BUF_SIZE];   // Bytes sent to the fd, NUL terminated
+    size_t out_len;
+    char in[STUB_BUF_SIZE];    // Bytes the next net_recv calls return
+    size_t in_len;
+    size_t in_pos;
+} stub_fd_t;
+
+static stub_fd_t stub_fds[STUB_MAX_FD];
+
+static stub_fd_t *get_stub(int fd)
+{
+    if (fd < 0 || fd >= STUB_MAX_FD)
+        return NULL;
+    return &stub_fds[fd];
+}
+
+void stub_clear(void)
+{
+    memset(stub_fds, 0, sizeof(stub_fds));
+}
+
+const char *stub_sent(int fd)
+{
+    stub_fd_t *stub = get_stub(fd);
+
+    return stub ? stub->out : "";
+}
+
+void stub_feed(int fd, const void *data, size_t len)
+{
+    stub_fd_t *stub = get_stub(fd);
+
+    if (!stub)
+        return;
+    if (len > STUB_BUF_SIZE)
+        len = STUB_BUF_SIZE;
+    memcpy(stub->in, data, len);
+    stub->in_len = len;
+    stub->in_pos = 0;
+}
+
+void net_send(int fd, const char *buf, size_t len)
+{
+    stub_fd_t *stub = get_stub(fd);
+
+    if (!stub)
+        return;
+    if (len >= STUB_BUF_SIZE - stub->out_len)
+        stub->out_len = 0;
+    memcpy(stub->out + stub->out_len, buf, len);
+    stub->out_len += len;
+    stub->out[stub->out_len] = '\0';
+}
+
+ssize_t net_recv(int fd, void *buf, size_t len)
+{
+    stub_fd_t *stub = get_stub(fd);
+    size_t left;
+
+    if (!stub || stub->in_pos == stub->in_len) {
+        errno = EAGAIN;
+        return -1;
+    }
+    left = stub->in_len - stub->in_pos;
+    if (len > left)
+        len = left;
+    memcpy(buf, stub->in + stub->in_pos, len);
+    stub->in_pos += len;
+    return len;
+}
+
+int net_backend_init(server_t *serv)
+{
+    (void)serv;
+    stub_clear();
+    return 0;
+}
+
+void net_backend_destroy(void)
+{
+}
+
+int net_wait(server_t *serv, long timeout_us)
+{
+    (void)serv;
+    (void)timeout_us;
+    return 0;
+}
+
+void net_watch(server_t *serv, int slot)
+{
+    (void)serv;
+    (void)slot;
+}
+
+void net_flush(void)
+{
+}
+
+bool net_peer_closed(int fd)
+{
+    (void)fd;
+    return false;
+}
+
+void net_close(int fd)
+{
+    (void)fd;
+}
+
+size_t net_pending(int fd)
+{
+    (void)fd;
+    return 0;
+}
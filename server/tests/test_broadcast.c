@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2025
+** test_broadcast.c
+** File description:
+** Broadcast directions against the protocol sectors
+*/
+
+#include "tests.h"
+#include <math.h>
+#include <stdlib.h>
+
+// Sender position of each K in the receiver frame, {forward, right}
+static const int sector_cells[8][2] = {
+    {1, 0}, {1, -1}, {0, -1}, {-1, -1}, {-1, 0}, {-1, 1}, {0, 1}, {1, 1}
+};
+
+static void test_broadcast_neighbours(void)
+{
+    fixture_t *fx = create_fixture(10, 10);
+    const look_coords_t *f;
+    coords_t from = {5, 5};
+    coords_t to;
+
+    for (int dir = UP; dir <= LEFT; dir++) {
+        f = get_direction_frame(dir);
+        for (int k = 0; k < 8; k++) {
+            to.x = from.x + f->fx * sector_cells[k][0] +
+                f->rx * sector_cells[k][1];
+            to.y = from.y + f->fy * sector_cells[k][0] +
+                f->ry * sector_cells[k][1];
+            CHECK(get_direction_number(from, to, dir, fx->game_info)
+                == k + 1);
+        }
+        CHECK(get_direction_number(from, from, dir, fx->game_info) == 0);
+    }
+    destroy_fixture(fx);
+}
+
+static void test_broadcast_wraps(void)
+{
+    fixture_t *fx = create_fixture(10, 10);
+
+    CHECK(get_direction_number((coords_t){0, 0}, (coords_t){9, 0}, UP,
+        fx->game_info) == 3);
+    CHECK(get_direction_number((coords_t){0, 0}, (coords_t){0, 9}, UP,
+        fx->game_info) == 5);
+    CHECK(get_direction_number((coords_t){0, 9}, (coords_t){0, 0}, RIGHT,
+        fx->game_info) == 3);
+    destroy_fixture(fx);
+}
+
+static int shortest(int delta, int size)
+{
+    if (abs(delta) > size / 2)
+        delta += (delta > 0) ? -size : size;
+    return delta;
+}
+
+static int ref_sector(int forward, int left)
+{
+    const double tan_pi_8 = 0.41421356237309503;
+    double a = abs(forward);
+    double b = abs(left);
+
+    if (forward == 0 && left == 0)
+        return 0;
+    if (b < a * tan_pi_8)
+        return (forward > 0) ? 1 : 5;
+    if (a < b * tan_pi_8)
+        return (left > 0) ? 3 : 7;
+    if (forward > 0)
+        return (left > 0) ? 2 : 8;
+    return (left > 0) ? 4 : 6;
+}
+
+static bool is_tie(int delta, int size)
+{
+    return size % 2 == 0 && abs(delta) * 2 == size;
+}
+
+static void check_random_pair(fixture_t *fx, int width, int height)
+{
+    coords_t from = {rand() % width, rand() % height};
+    coords_t to = {rand() % width, rand() % height};
+    int dir = UP + rand() % 4;
+    const look_coords_t *f = get_direction_frame(dir);
+    int dx = shortest(to.x - from.x, width);
+    int dy = shortest(to.y - from.y, height);
+
+    if (is_tie(dx, width) || is_tie(dy, height))
+        return;
+    CHECK(get_direction_number(from, to, dir, fx->game_info) ==
+        ref_sector(dx * f->fx + dy * f->fy, -(dx * f->rx + dy * f->ry)));
+}
+
+static void test_broadcast_matches_reference(void)
+{
+    int width;
+    int height;
+    fixture_t *fx;
+
+    for (int map = 0; map < 5; map++) {
+        width = 3 + rand() % 30;
+        height = 3 + rand() % 30;
+        fx = create_fixture(width, height);
+        for (int run = 0; run < PROPERTY_RUNS; run++)
+            check_random_pair(fx, width, height);
+        destroy_fixture(fx);
+    }
+}
+
+const test_case_t broadcast_tests[] = {
+    {"eight neighbours for each facing", test_broadcast_neighbours},
+    {"shortest path across the edges", test_broadcast_wraps},
+    {"matches the sector reference", test_broadcast_matches_reference},
+    {NULL, NULL}
+};
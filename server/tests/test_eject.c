@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** test_eject.c
+** File description:
+** Eject moves, wrapping and the side announced to the ejected players
+*/
+
+#include "tests.h"
+#include "team_slots.h"
+
+static int ref_origin(int push, int facing)
+{
+    const look_coords_t *p = get_direction_frame(push);
+    const look_coords_t *f = get_direction_frame(facing);
+    int forward = -p->fx * f->fx - p->fy * f->fy;
+    int right = -p->fx * f->rx - p->fy * f->ry;
+
+    if (forward > 0)
+        return 1;
+    if (forward < 0)
+        return 5;
+    return (right > 0) ? 7 : 3;
+}
+
+static void test_eject_origin_sides(void)
+{
+    player_t ejector = {0};
+    player_t ejected = {0};
+
+    for (int push = UP; push <= LEFT; push++) {
+        for (int facing = UP; facing <= LEFT; facing++) {
+            ejector.direction = push;
+            ejected.direction = facing;
+            CHECK(get_ejection_direction(&ejector, &ejected) ==
+                ref_origin(push, facing));
+        }
+    }
+    ejector.direction = UP;
+    ejected.direction = UP;
+    CHECK(get_ejection_direction(&ejector, &ejected) == 5);
+    ejected.direction = RIGHT;
+    CHECK(get_ejection_direction(&ejector, &ejected) == 7);
+}
+
+// -1 when a prev link does not match the list
+static int count_team_nodes(linked_teams_t *team)
+{
+    linked_client_t *prev = NULL;
+    int count = 0;
+
+    for (linked_client_t *node = team->head_client; node; node = node->next) {
+        if (node->prev != prev)
+            return -1;
+        prev = node;
+        count++;
+    }
+    return count;
+}
+
+static void test_eject_moves_and_notifies(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *ejector = spawn_player(fx, (coords_t){0, 2}, LEFT, 3);
+    linked_client_t *down = spawn_player(fx, (coords_t){0, 2}, DOWN, 4);
+    linked_client_t *left = spawn_player(fx, (coords_t){0, 2}, LEFT, 5);
+    map_t *map = &fx->game_info->map;
+    linked_teams_t *team = ejector->player->team;
+    int nb_nodes = count_team_nodes(team);
+    linked_client_t *moved;
+
+    fork_player(fx->game_info, ejector, fx->serv, "");
+    fork_player(fx->game_info, ejector, fx->serv, "");
+    stub_clear();
+    eject(fx->game_info, ejector, fx->serv, "");
+    CHECK_STR(stub_sent(3), "ok\n");
+    CHECK_STR(stub_sent(4), "eject: 3\n");
+    CHECK_STR(stub_sent(5), "eject: 5\n");
+    CHECK(down->player->coords.x == 4 && down->player->coords.y == 2);
+    CHECK(left->player->coords.x == 4 && left->player->coords.y == 2);
+    CHECK(map->nb_players[tile_index(map, (coords_t){0, 2})] == 1);
+    CHECK(map->nb_players[tile_index(map, (coords_t){4, 2})] == 2);
+    CHECK(get_tile_eggs(map, (coords_t){0, 2}) == NULL);
+    CHECK(count_team_nodes(team) == nb_nodes);
+    CHECK(get_tile_players(map, (coords_t){0, 2}) == ejector);
+    moved = get_tile_players(map, (coords_t){4, 2});
+    CHECK(moved != NULL && moved->player->tile_next != NULL);
+    CHECK(moved->player->id < moved->player->tile_next->player->id);
+    destroy_fixture(fx);
+}
+
+static void test_eject_alone(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *ejector = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+
+    spawn_player(fx, (coords_t){1, 2}, UP, 4);
+    eject(fx->game_info, ejector, fx->serv, "");
+    CHECK_STR(stub_sent(3), "ko\n");
+    CHECK_STR(stub_sent(4), "");
+    destroy_fixture(fx);
+}
+
+static void test_eject_target_wraps(void)
+{
+    fixture_t *fx = create_fixture(4, 3);
+    player_t player = {0};
+    coords_t target;
+
+    player.coords = (coords_t){3, 2};
+    target = get_ejection_target(player.coords, UP);
+    player.coords = target;
+    verif_limits(&player, fx->game_info);
+    CHECK(player.coords.x == 3 && player.coords.y == 0);
+    target = get_ejection_target(player.coords, RIGHT);
+    player.coords = target;
+    verif_limits(&player, fx->game_info);
+    CHECK(player.coords.x == 0 && player.coords.y == 0);
+    destroy_fixture(fx);
+}
+
+const test_case_t eject_tests[] = {
+    {"side announced for each push and facing", test_eject_origin_sides},
+    {"moves, notifies and destroys eggs", test_eject_moves_and_notifies},
+    {"nobody to eject", test_eject_alone},
+    {"target wraps around the map", test_eject_target_wraps},
+    {NULL, NULL}
+};
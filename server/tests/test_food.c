@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** test_food.c
+** File description:
+** one food eaten every 126 / f seconds, starvation on the last one
+*/
+
+#include "tests.h"
+
+static double period(fixture_t *fx)
+{
+    return 126.0 / fx->game_info->freq;
+}
+
+static void backdate(struct timespec *ts, double seconds)
+{
+    struct timespec now;
+    long ns = (long)(seconds * 1000000000.0);
+
+    get_current_time(&now);
+    now.tv_sec -= ns / 1000000000;
+    now.tv_nsec -= ns % 1000000000;
+    if (now.tv_nsec < 0) {
+        now.tv_sec--;
+        now.tv_nsec += 1000000000;
+    }
+    *ts = now;
+}
+
+static double waited(struct timespec *ts)
+{
+    struct timespec now;
+
+    get_current_time(&now);
+    return timespec_diff(ts, &now);
+}
+
+static void test_food_not_due(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+
+    backdate(&p->player->time_eat, period(fx) * 0.5);
+    eat_food(p, fx->game_info);
+    CHECK(p->player->inventory.food == 10);
+    CHECK(p->player->state == ALIVE);
+    destroy_fixture(fx);
+}
+
+static void test_food_catches_up_without_drift(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+
+    backdate(&p->player->time_eat, period(fx) * 3.5);
+    eat_food(p, fx->game_info);
+    CHECK(p->player->inventory.food == 7);
+    CHECK(waited(&p->player->time_eat) > period(fx) * 0.45);
+    CHECK(waited(&p->player->time_eat) < period(fx) * 0.9);
+    destroy_fixture(fx);
+}
+
+static void test_food_starvation(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+    map_t *map = &fx->game_info->map;
+
+    p->player->inventory.food = 1;
+    backdate(&p->player->time_eat, period(fx) * 1.1);
+    eat_food(p, fx->game_info);
+    CHECK(p->player->inventory.food == 0);
+    CHECK(p->player->state == ALIVE);
+    backdate(&p->player->time_eat, period(fx) * 5.1);
+    eat_food(p, fx->game_info);
+    CHECK(p->player->inventory.food == -1);
+    CHECK(p->player->state == DEAD);
+    CHECK(fx->game_info->nb_dead == 1);
+    CHECK(map->nb_players[tile_index(map, (coords_t){1, 1})] == 0);
+    destroy_fixture(fx);
+}
+
+static void test_food_matches_elapsed_periods(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+    int periods;
+
+    for (int run = 0; run < PROPERTY_RUNS / 10; run++) {
+        fx->game_info->freq = 1 + rand() % 1000;
+        periods = rand() % 5;
+        p->player->inventory.food = 10;
+        backdate(&p->player->time_eat, period(fx) * (periods + 0.5));
+        eat_food(p, fx->game_info);
+        CHECK(p->player->inventory.food == 10 - periods);
+    }
+    destroy_fixture(fx);
+}
+
+const test_case_t food_tests[] = {
+    {"nothing eaten before the period", test_food_not_due},
+    {"late checks eat every elapsed period",
+        test_food_catches_up_without_drift},
+    {"dies once the food runs out", test_food_starvation},
+    {"matches the number of elapsed periods",
+        test_food_matches_elapsed_periods},
+    {NULL, NULL}
+};
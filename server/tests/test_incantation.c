@@ -0,0 +1,155 @@
+/*
+** EPITECH PROJECT, 2025
+** test_incantation.c
+** File description:
+** elevation requirements of each level against the protocol table
+*/
+
+#include "tests.h"
+#include "incantation.h"
+
+// Players, linemate, deraumere, sibur, mendiane, phiras, thystame
+static const int protocol_reqs[7][7] = {
+    {1, 1, 0, 0, 0, 0, 0},
+    {2, 1, 1, 1, 0, 0, 0},
+    {2, 2, 0, 1, 0, 2, 0},
+    {4, 1, 1, 2, 0, 1, 0},
+    {4, 1, 2, 1, 3, 0, 0},
+    {6, 1, 2, 3, 0, 1, 0},
+    {6, 2, 2, 2, 2, 2, 1}
+};
+
+static int *stone(inventory_t *inv, int i)
+{
+    int *stones[] = {&inv->linemate, &inv->deraumere, &inv->sibur,
+        &inv->mendiane, &inv->phiras, &inv->thystame};
+
+    return stones[i];
+}
+
+static void set_ritual(fixture_t *fx, incantation_t *ritual,
+    int level, int nb_players)
+{
+    memset(ritual, 0, sizeof(incantation_t));
+    ritual->coords = (coords_t){2, 2};
+    ritual->level = level;
+    ritual->members = calloc(2 * FIXTURE_SLOTS, sizeof(linked_client_t *));
+    for (int i = 0; i < nb_players; i++) {
+        ritual->members[i] = spawn_player(fx, ritual->coords, UP, 3 + i);
+        ritual->members[i]->player->level = level;
+    }
+    ritual->nb_members = nb_players;
+}
+
+static void fill_exact(fixture_t *fx, int level)
+{
+    inventory_t *tile = &fx->game_info->map.block[2][2];
+
+    memset(tile, 0, sizeof(inventory_t));
+    for (int i = 0; i < 6; i++)
+        *stone(tile, i) = protocol_reqs[level - 1][i + 1];
+}
+
+static void check_missing_stones(fixture_t *fx, incantation_t *ritual)
+{
+    inventory_t *tile = &fx->game_info->map.block[2][2];
+
+    for (int i = 0; i < 6; i++) {
+        if (*stone(tile, i) == 0)
+            continue;
+        (*stone(tile, i))--;
+        CHECK(!can_elevate(fx->game_info, ritual));
+        (*stone(tile, i))++;
+    }
+}
+
+static void check_level(int level)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    int needed = protocol_reqs[level - 1][0];
+    incantation_t ritual;
+
+    set_ritual(fx, &ritual, level, needed);
+    fill_exact(fx, level);
+    CHECK(can_elevate(fx->game_info, &ritual));
+    check_missing_stones(fx, &ritual);
+    ritual.nb_members--;
+    CHECK(!can_elevate(fx->game_info, &ritual));
+    ritual.nb_members++;
+    ritual.members[0]->player->level = level + 1;
+    CHECK(!can_elevate(fx->game_info, &ritual));
+    consume_elevation_resources(fx->game_info, ritual.coords, level);
+    for (int i = 0; i < 6; i++)
+        CHECK(*stone(&fx->game_info->map.block[2][2], i) == 0);
+    free(ritual.members);
+    destroy_fixture(fx);
+}
+
+static void test_incantation_each_level(void)
+{
+    for (int level = 1; level <= 7; level++)
+        check_level(level);
+}
+
+static bool ref_can_elevate(inventory_t *tile, int level, int nb_players)
+{
+    if (level < 1 || level > 7 || nb_players < protocol_reqs[level - 1][0])
+        return false;
+    for (int i = 0; i < 6; i++) {
+        if (*stone(tile, i) < protocol_reqs[level - 1][i + 1])
+            return false;
+    }
+    return true;
+}
+
+static void check_random_ritual(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    inventory_t *tile = &fx->game_info->map.block[2][2];
+    int level = 1 + rand() % 8;
+    int nb_players = 1 + rand() % (2 * FIXTURE_SLOTS);
+    incantation_t ritual;
+
+    set_ritual(fx, &ritual, level, nb_players);
+    for (int i = 0; i < 6; i++)
+        *stone(tile, i) = rand() % 4;
+    CHECK(can_elevate(fx->game_info, &ritual) ==
+        ref_can_elevate(tile, level, nb_players));
+    free(ritual.members);
+    destroy_fixture(fx);
+}
+
+static void test_incantation_matches_reference(void)
+{
+    for (int run = 0; run < PROPERTY_RUNS / 4; run++)
+        check_random_ritual();
+}
+
+static void test_incantation_gathers_tile(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *leader = spawn_player(fx, (coords_t){2, 2}, UP, 3);
+    linked_client_t *mate = spawn_player(fx, (coords_t){2, 2}, UP, 4);
+    linked_client_t *low = spawn_player(fx, (coords_t){2, 2}, UP, 5);
+    linked_client_t *far = spawn_player(fx, (coords_t){3, 2}, UP, 6);
+    incantation_t *ritual;
+
+    leader->player->level = 2;
+    mate->player->level = 2;
+    far->player->level = 2;
+    ritual = create_incantation(&fx->game_info->map, leader);
+    CHECK(ritual != NULL && ritual->nb_members == 2);
+    for (size_t i = 0; ritual && i < ritual->nb_members; i++) {
+        CHECK(ritual->members[i] == leader || ritual->members[i] == mate);
+        CHECK(ritual->members[i] != low && ritual->members[i] != far);
+    }
+    destroy_incantation(ritual);
+    destroy_fixture(fx);
+}
+
+const test_case_t incantation_tests[] = {
+    {"exact requirements of each level", test_incantation_each_level},
+    {"matches the protocol table", test_incantation_matches_reference},
+    {"gathers the players of the tile", test_incantation_gathers_tile},
+    {NULL, NULL}
+};
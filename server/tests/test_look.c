@@ -0,0 +1,196 @@
+/*
+** EPITECH PROJECT, 2025
+** test_look.c
+** File description:
+** Look answers against the protocol order and a naive reference
+*/
+
+#include "tests.h"
+
+    #define LOOK_REF_SIZE 65536
+
+static const char *ref_objects[] = {"food", "linemate", "deraumere",
+    "sibur", "mendiane", "phiras", "thystame"};
+
+static int count_players_on(fixture_t *fx, int x, int y)
+{
+    int count = 0;
+
+    for (linked_teams_t *t = fx->serv->head_team; t; t = t->next) {
+        for (linked_client_t *c = t->head_client; c; c = c->next)
+            count += (c->player->state == ALIVE &&
+                c->player->coords.x == x && c->player->coords.y == y);
+    }
+    return count;
+}
+
+static void ref_append(char *out, const char *object, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (out[0] != '\0' && out[strlen(out) - 1] != '[' &&
+            out[strlen(out) - 1] != ',')
+            strcat(out, " ");
+        strcat(out, object);
+    }
+}
+
+static void ref_tile(fixture_t *fx, int x, int y, char *out)
+{
+    map_t *map = &fx->game_info->map;
+    inventory_t *inv;
+    int counts[7];
+
+    x = ((x % map->width) + map->width) % map->width;
+    y = ((y % map->height) + map->height) % map->height;
+    inv = &map->block[y][x];
+    counts[0] = inv->food;
+    counts[1] = inv->linemate;
+    counts[2] = inv->deraumere;
+    counts[3] = inv->sibur;
+    counts[4] = inv->mendiane;
+    counts[5] = inv->phiras;
+    counts[6] = inv->thystame;
+    ref_append(out, "player", count_players_on(fx, x, y));
+    for (int i = 0; i < 7; i++)
+        ref_append(out, ref_objects[i], counts[i]);
+}
+
+static void ref_seen_tile(player_t *p, int line, int side, coords_t *tile)
+{
+    int x = p->coords.x;
+    int y = p->coords.y;
+
+    if (p->direction == UP)
+        *tile = (coords_t){x + side, y + line};
+    if (p->direction == RIGHT)
+        *tile = (coords_t){x + line, y - side};
+    if (p->direction == DOWN)
+        *tile = (coords_t){x - side, y - line};
+    if (p->direction == LEFT)
+        *tile = (coords_t){x - line, y + side};
+}
+
+static void ref_look(fixture_t *fx, player_t *p, char *out)
+{
+    int level = (p->level > LOOK_MAX_LEVEL) ? LOOK_MAX_LEVEL : p->level;
+    coords_t tile;
+
+    strcpy(out, "[");
+    for (int line = 0; line <= level; line++) {
+        for (int side = -line; side <= line; side++) {
+            if (line > 0)
+                strcat(out, ",");
+            ref_seen_tile(p, line, side, &tile);
+            ref_tile(fx, tile.x, tile.y, out);
+        }
+    }
+    strcat(out, "]\n");
+}
+
+static const char *run_look(fixture_t *fx, linked_client_t *player)
+{
+    stub_clear();
+    look(fx->game_info, player, fx->serv, "");
+    return stub_sent(player->client->client_fd);
+}
+
+static void put(fixture_t *fx, int x, int y, inventory_t inv)
+{
+    fx->game_info->map.block[y][x] = inv;
+    touch_tile(&fx->game_info->map, (coords_t){x, y});
+}
+
+static void test_look_golden_up(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){2, 2}, UP, 3);
+
+    put(fx, 2, 2, (inventory_t){.food = 1});
+    put(fx, 1, 3, (inventory_t){.linemate = 1});
+    put(fx, 3, 3, (inventory_t){.thystame = 2});
+    CHECK_STR(run_look(fx, p), "[player food,linemate,,thystame thystame]\n");
+    destroy_fixture(fx);
+}
+
+static void test_look_golden_right(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){2, 2}, RIGHT, 3);
+
+    put(fx, 3, 3, (inventory_t){.food = 2, .sibur = 1});
+    put(fx, 3, 1, (inventory_t){.phiras = 1});
+    spawn_player(fx, (coords_t){3, 2}, DOWN, 4);
+    CHECK_STR(run_look(fx, p), "[player,food food sibur,player,phiras]\n");
+    destroy_fixture(fx);
+}
+
+static void test_look_golden_wrap(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){0, 0}, LEFT, 3);
+
+    put(fx, 4, 4, (inventory_t){.mendiane = 1});
+    put(fx, 4, 0, (inventory_t){.deraumere = 1});
+    put(fx, 4, 1, (inventory_t){.food = 1, .thystame = 1});
+    CHECK_STR(run_look(fx, p),
+        "[player,mendiane,deraumere,food thystame]\n");
+    destroy_fixture(fx);
+}
+
+static void randomize_tile(fixture_t *fx)
+{
+    map_t *map = &fx->game_info->map;
+    int x = rand() % map->width;
+    int y = rand() % map->height;
+
+    put(fx, x, y, (inventory_t){rand() % 3, rand() % 2, rand() % 2,
+        rand() % 2, rand() % 2, rand() % 2, rand() % 2});
+}
+
+static void random_action(fixture_t *fx, linked_client_t *p)
+{
+    static const exec_cmd_ai_t actions[] = {
+        {"Forward", forward}, {"Right", right}, {"Left", left},
+        {"Take", take}, {"Set", drop}
+    };
+    int i = rand() % 6;
+
+    if (i == 5) {
+        randomize_tile(fx);
+        return;
+    }
+    actions[i].exec_fct(fx->game_info, p, fx->serv, (i >= 3) ? "food" : "");
+    if (rand() % 8 == 0)
+        p->player->level = 1 + rand() % 8;
+}
+
+static void test_look_matches_reference(void)
+{
+    fixture_t *fx = create_fixture(7, 5);
+    linked_client_t *players[6];
+    char *expected = malloc(LOOK_REF_SIZE);
+    linked_client_t *p;
+
+    for (int i = 0; i < 6; i++)
+        players[i] = spawn_player(fx, (coords_t){rand() % 7, rand() % 5},
+            UP + rand() % 4, 3 + i);
+    for (int i = 0; i < 20; i++)
+        randomize_tile(fx);
+    for (int run = 0; run < PROPERTY_RUNS; run++) {
+        random_action(fx, players[rand() % 6]);
+        p = players[rand() % 6];
+        ref_look(fx, p->player, expected);
+        if (!CHECK_STR(run_look(fx, p), expected))
+            break;
+    }
+    free(expected);
+    destroy_fixture(fx);
+}
+
+const test_case_t look_tests[] = {
+    {"golden facing up", test_look_golden_up},
+    {"golden facing right", test_look_golden_right},
+    {"golden wrapping the map", test_look_golden_wrap},
+    {"cached answers match the reference", test_look_matches_reference},
+    {NULL, NULL}
+};
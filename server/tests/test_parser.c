@@ -0,0 +1,120 @@
+/*
+** EPITECH PROJECT, 2025
+** test_parser.c
+** File description:
+** command framing of the circular buffer and queueing of the AI commands
+*/
+
+#include "tests.h"
+
+static void write_circbuf(circbuf_t *cb, const char *str)
+{
+    for (size_t i = 0; str[i] && cb->len < CIRCBUF_SIZE; i++) {
+        cb->data[cb->head] = str[i];
+        cb->head = (cb->head + 1) % CIRCBUF_SIZE;
+        cb->len++;
+    }
+}
+
+static void test_parser_framing(void)
+{
+    circbuf_t cb = {0};
+    char line[64];
+
+    write_circbuf(&cb, "Forward\nLook\r\n\n\r\nRig");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 7);
+    CHECK_STR(line, "Forward");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 4);
+    CHECK_STR(line, "Look");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 0);
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 0);
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == -1);
+    CHECK(cb.len == 3);
+    write_circbuf(&cb, "ht\n");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 5);
+    CHECK_STR(line, "Right");
+    CHECK(cb.len == 0);
+}
+
+static void test_parser_wraps_and_discards(void)
+{
+    circbuf_t cb = {0};
+    char line[16];
+
+    cb.head = CIRCBUF_SIZE - 3;
+    cb.tail = CIRCBUF_SIZE - 3;
+    write_circbuf(&cb, "Inventory\nBroadcast a long message\nLeft\n");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 9);
+    CHECK_STR(line, "Inventory");
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == -2);
+    CHECK(read_command_from_buffer(&cb, line, sizeof(line)) == 4);
+    CHECK_STR(line, "Left");
+    CHECK(!has_complete_command(&cb));
+}
+
+static void test_parser_queues_commands(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+    char line[] = "Take\tfood";
+    char unknown[] = "Dance";
+    command_ai_t *cmd;
+
+    parse_line_command(p, line);
+    parse_line_command(p, unknown);
+    cmd = peek(p->player->command);
+    CHECK(cmd != NULL && strcmp(cmd->name, "Take") == 0);
+    CHECK(cmd != NULL && strcmp(cmd->args, "food") == 0);
+    dequeue(p->player->command);
+    CHECK(is_empty_ai(p->player->command));
+    CHECK_STR(stub_sent(3), "ko\n");
+    destroy_fixture(fx);
+}
+
+static void test_parser_keeps_long_arguments(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+    char line[CIRCBUF_SIZE] = "Broadcast ";
+    char take[] = "Take food";
+    command_ai_t *cmd;
+
+    memset(line + 10, 'x', CIRCBUF_SIZE - 11);
+    parse_line_command(p, line);
+    parse_line_command(p, take);
+    cmd = peek(p->player->command);
+    CHECK(cmd != NULL && cmd->long_args != NULL);
+    CHECK(cmd != NULL && strlen(get_command_args(cmd)) == CIRCBUF_SIZE - 11);
+    dequeue(p->player->command);
+    cmd = peek(p->player->command);
+    CHECK(cmd != NULL && cmd->long_args == NULL);
+    CHECK(cmd != NULL && strcmp(get_command_args(cmd), "food") == 0);
+    CHECK_STR(stub_sent(3), "");
+    parse_line_command(p, line);
+    destroy_fixture(fx);
+}
+
+static void test_parser_blank_lines_do_not_stall(void)
+{
+    fixture_t *fx = create_fixture(5, 5);
+    linked_client_t *p = spawn_player(fx, (coords_t){1, 1}, UP, 3);
+    const char input[] = "\nForward\n\r\n\nRight\n";
+    queue_command_ai_t *queue = p->player->command;
+
+    stub_feed(3, input, sizeof(input) - 1);
+    CHECK(receive_into_circbuf(p->client) == (int)sizeof(input) - 1);
+    parse_client_command(fx->serv, p);
+    CHECK(queue->rear - queue->front == 2);
+    CHECK(!has_complete_command(&p->client->circbuf));
+    destroy_fixture(fx);
+}
+
+const test_case_t parser_tests[] = {
+    {"lines, blank lines and CRLF", test_parser_framing},
+    {"wrap around and too long lines", test_parser_wraps_and_discards},
+    {"known commands queued, others ko", test_parser_queues_commands},
+    {"argument longer than a record", test_parser_keeps_long_arguments},
+    {"blank lines do not stall the client",
+        test_parser_blank_lines_do_not_stall},
+    {NULL, NULL}
+};
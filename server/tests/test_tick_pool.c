@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** test_tick_pool.c
+** File description:
+** the same command script gives the same bytes with 1 and N bands
+*/
+
+#include "tests.h"
+#include "tick_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+    #define TICK_PLAYERS 24
+    #define TICK_ROUNDS 40
+    #define TICK_BANDS 4
+    #define TICK_GUI_FD 63
+
+typedef struct tick_script_s {
+    const char *name;          // Entry of tab_command_ai
+    const char *args;          // Argument sent with the command
+} tick_script_t;
+
+static const tick_script_t script_cmds[] = {
+    {"Forward", ""},
+    {"Right", ""},
+    {"Left", ""},
+    {"Look", ""},
+    {"Inventory", ""},
+    {"Connect_nbr", ""},
+    {"Take", "food"},
+    {"Take", "linemate"},
+    {"Set", "food"},
+    {"Broadcast", "hello"},
+    {NULL, NULL}
+};
+
+static int find_cmd_index(const char *name)
+{
+    for (int i = 0; tab_command_ai[i].name != NULL; i++) {
+        if (strcmp(tab_command_ai[i].name, name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static void queue_script_cmd(linked_client_t *client)
+{
+    int nb_cmds = sizeof(script_cmds) / sizeof(script_cmds[0]) - 1;
+    const tick_script_t *line = &script_cmds[rand() % nb_cmds];
+    command_ai_t *cmd = enqueue(client->player->command);
+
+    cmd->index = find_cmd_index(line->name);
+    cmd->name = tab_command_ai[cmd->index].name;
+    cmd->time = tab_command_ai[cmd->index].time;
+    snprintf(cmd->args, sizeof(cmd->args), "%s", line->args);
+}
+
+static void fill_map(fixture_t *fx)
+{
+    map_t *map = &fx->game_info->map;
+
+    for (int y = 0; y < map->height; y++) {
+        for (int x = 0; x < map->width; x++) {
+            map->block[y][x].food = rand() % 3;
+            map->block[y][x].linemate = rand() % 2;
+            touch_tile(map, (coords_t){x, y});
+        }
+    }
+}
+
+// Runs the seeded script, returns the bytes sent to each fd
+static char **run_script(int nb_bands)
+{
+    fixture_t *fx;
+    linked_client_t *clients[TICK_PLAYERS];
+    char **sent = calloc(TICK_GUI_FD + 1, sizeof(char *));
+
+    stub_clear();
+    fx = create_fixture_slots(12, 16, TICK_PLAYERS / 2);
+    // The map generation seeds rand() with the time, seed after it
+    srand(1234);
+    fx->serv->pool = create_tick_pool(nb_bands);
+    fx->serv->gui_client = calloc(1, sizeof(gui_t));
+    fx->serv->gui_client->client = calloc(1, sizeof(client_t));
+    fx->serv->gui_client->client->client_fd = TICK_GUI_FD;
+    fill_map(fx);
+    for (int i = 0; i < TICK_PLAYERS; i++) {
+        clients[i] = spawn_player(fx, (coords_t){rand() % 12, rand() % 16},
+            UP + rand() % 4, 3 + i);
+        CHECK(clients[i] != NULL);
+    }
+    for (int round = 0; round < TICK_ROUNDS; round++) {
+        for (int i = 0; i < TICK_PLAYERS; i++) {
+            queue_script_cmd(clients[i]);
+            push_ready_command(fx->serv->pool, clients[i],
+                peek(clients[i]->player->command), fx->game_info);
+        }
+        execute_ready_commands(fx->serv, fx->game_info);
+    }
+    for (int fd = 3; fd <= TICK_GUI_FD; fd++)
+        sent[fd] = strdup(stub_sent(fd));
+    destroy_fixture(fx);
+    return sent;
+}
+
+static void test_tick_bands_match_single_band(void)
+{
+    char **single = run_script(1);
+    char **banded = run_script(TICK_BANDS);
+
+    CHECK(strlen(single[TICK_GUI_FD]) > 0);
+    for (int fd = 3; fd <= TICK_GUI_FD; fd++) {
+        CHECK_STR(banded[fd], single[fd]);
+        free(single[fd]);
+        free(banded[fd]);
+    }
+    free(single);
+    free(banded);
+}
+
+static void test_tick_phase_table_matches_commands(void)
+{
+    size_t nb_cmds = 0;
+
+    while (tab_command_ai[nb_cmds].name != NULL)
+        nb_cmds++;
+    CHECK(sizeof(tab_phase_ai) / sizeof(tab_phase_ai[0]) == nb_cmds + 1);
+    CHECK(tab_phase_ai[find_cmd_index("Look")].phase == PHASE_READ);
+    CHECK(tab_phase_ai[find_cmd_index("Take")].phase == PHASE_LOCAL);
+    CHECK(tab_phase_ai[find_cmd_index("Forward")].moves);
+    CHECK(tab_phase_ai[find_cmd_index("Eject")].phase == PHASE_SERIAL);
+}
+
+const test_case_t tick_pool_tests[] = {
+    {"1 and N bands send the same bytes", test_tick_bands_match_single_band},
+    {"phase table follows the commands",
+        test_tick_phase_table_matches_commands},
+    {NULL, NULL}
+};
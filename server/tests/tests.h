@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** tests.h
+** File description:
+** unit and property tests of the game rules, run without sockets
+*/
+
+#ifndef TESTS_H_
+    #define TESTS_H_
+    #include "game_info.h"
+    #include "commands.h"
+    #include <stdbool.h>
+    #include <stddef.h>
+    #define FIXTURE_SLOTS 4
+    #define PROPERTY_RUNS 2000
+    #define CHECK(cond) test_check((cond), #cond, __FILE__, __LINE__)
+    #define CHECK_STR(got, exp) test_check_str(got, exp, __FILE__, __LINE__)
+
+typedef struct test_case_s {
+    const char *name;
+    void (*fct)(void);
+} test_case_t;
+
+typedef struct fixture_s {
+    args_t args;               // Arguments the game was built from
+    char *team_names[3];       // Teams "a" and "b", NULL terminated
+    game_info_t *game_info;
+    server_t *serv;
+} fixture_t;
+
+bool test_check(bool cond, const char *expr, const char *file, int line);
+
+bool test_check_str(const char *got, const char *exp,
+    const char *file, int line);
+
+fixture_t *create_fixture(int width, int height);
+
+fixture_t *create_fixture_slots(int width, int height, int slots);
+
+void destroy_fixture(fixture_t *fx);
+
+void clear_map(fixture_t *fx);
+
+linked_client_t *spawn_player(fixture_t *fx, coords_t coords,
+    direction_t direction, int fd);
+
+void stub_clear(void);
+
+const char *stub_sent(int fd);
+
+void stub_feed(int fd, const void *data, size_t len);
+
+extern const test_case_t look_tests[];
+extern const test_case_t broadcast_tests[];
+extern const test_case_t incantation_tests[];
+extern const test_case_t eject_tests[];
+extern const test_case_t food_tests[];
+extern const test_case_t parser_tests[];
+extern const test_case_t tick_pool_tests[];
+
+#endif /* !TESTS_H_ */
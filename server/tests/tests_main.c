@@ -0,0 +1,83 @@
+/*
+** EPITECH PROJECT, 2025
+** tests_main.c
+** File description:
+** runner of the unit and property tests, exits with 84 on a failure
+*/
+
+#include "tests.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct test_suite_s {
+    const char *name;
+    const test_case_t *cases;
+} test_suite_t;
+
+static const test_suite_t suites[] = {
+    {"look", look_tests},
+    {"broadcast", broadcast_tests},
+    {"incantation", incantation_tests},
+    {"eject", eject_tests},
+    {"food", food_tests},
+    {"parser", parser_tests},
+    {"tick pool", tick_pool_tests},
+    {NULL, NULL}
+};
+
+static int nb_failed_checks = 0;
+
+bool test_check(bool cond, const char *expr, const char *file, int line)
+{
+    if (!cond) {
+        fprintf(stderr, "    %s:%d: CHECK(%s) failed\n", file, line, expr);
+        nb_failed_checks++;
+    }
+    return cond;
+}
+
+bool test_check_str(const char *got, const char *exp,
+    const char *file, int line)
+{
+    if (got && exp && strcmp(got, exp) == 0)
+        return true;
+    fprintf(stderr, "    %s:%d: got \"%s\", expected \"%s\"\n", file, line,
+        got ? got : "(null)", exp ? exp : "(null)");
+    nb_failed_checks++;
+    return false;
+}
+
+static int run_suite(const test_suite_t *suite, int *nb_tests)
+{
+    int failed = 0;
+    int before;
+
+    for (int i = 0; suite->cases[i].name; i++) {
+        before = nb_failed_checks;
+        stub_clear();
+        suite->cases[i].fct();
+        (*nb_tests)++;
+        if (nb_failed_checks != before) {
+            fprintf(stderr, "[FAIL] %s: %s\n", suite->name,
+                suite->cases[i].name);
+            failed++;
+        }
+    }
+    return failed;
+}
+
+int main(int ac, char **av)
+{
+    int nb_tests = 0;
+    int failed = 0;
+
+    if (ac < 2 || strcmp(av[1], "-v") != 0)
+        freopen("/dev/null", "w", stdout);
+    srand(42);
+    for (int i = 0; suites[i].name; i++)
+        failed += run_suite(&suites[i], &nb_tests);
+    fprintf(stderr, "Tested: %d, Passing: %d, Failing: %d\n", nb_tests,
+        nb_tests - failed, failed);
+    return (failed > 0) ? 84 : 0;
+}